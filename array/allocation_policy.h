@@ -0,0 +1,214 @@
+#ifndef __XSTL_ALLOCATION_POLICY__
+#define __XSTL_ALLOCATION_POLICY__
+
+/*
+    Allocation Policies for fixed_vector.
+    A policy is a stateless type with static allocate(bytes, alignment) / deallocate(pointer, bytes, alignment).
+    deallocate gets the same bytes and alignment that allocate was called with.
+    zero_initialized tells the container that fresh memory already reads as zero.
+*/
+
+#include <cstddef>
+#include <cstdlib>
+#include <cerrno>
+#include <new>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <malloc.h> //_aligned_malloc
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/syscall.h> //SYS_mbind, SYS_getcpu
+#endif
+
+namespace xstl
+{
+    //alignment(2의 거듭제곱) 경계에 맞춰 할당합니다. _free_aligned로 반환해야 합니다.
+    inline void *_allocate_aligned(std::size_t bytes, std::size_t alignment)
+    {
+        if (alignment < sizeof(void *))
+            alignment = sizeof(void *);
+
+#if defined(_WIN32)
+        void *pointer = _aligned_malloc(bytes, alignment);
+        if (pointer == nullptr)
+            throw std::bad_alloc();
+        return pointer;
+#else
+        void *pointer = nullptr;
+        if (posix_memalign(&pointer, alignment, bytes) != 0)
+            throw std::bad_alloc();
+        return pointer;
+#endif
+    }
+    inline void _free_aligned(void *pointer) noexcept
+    {
+#if defined(_WIN32)
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+
+    //operator new를 씁니다. operator new가 보장하는 것보다 큰 alignment만 따로 맞춥니다.
+    struct default_allocation
+    {
+        static constexpr bool zero_initialized = false;
+#if defined(__STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        static constexpr std::size_t new_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#else
+        static constexpr std::size_t new_alignment = alignof(std::max_align_t);
+#endif
+
+        static void *allocate(std::size_t bytes, std::size_t alignment)
+        {
+            if (alignment <= new_alignment)
+                return ::operator new(bytes);
+            return _allocate_aligned(bytes, alignment);
+        }
+        static void deallocate(void *pointer, std::size_t, std::size_t alignment) noexcept
+        {
+            if (alignment <= new_alignment)
+                ::operator delete(pointer);
+            else
+                _free_aligned(pointer);
+        }
+    };
+
+    //Alignment 경계에 맞춘 메모리입니다. SIMD load/store나 false sharing 회피에 씁니다.
+    template <std::size_t Alignment = 64>
+    struct aligned_allocation
+    {
+        static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+        static constexpr bool zero_initialized = false;
+
+        static void *allocate(std::size_t bytes, std::size_t alignment)
+        {
+            return _allocate_aligned(bytes, alignment < Alignment ? Alignment : alignment);
+        }
+        static void deallocate(void *pointer, std::size_t, std::size_t) noexcept
+        {
+            _free_aligned(pointer);
+        }
+    };
+
+    //mmap_allocation의 옵션입니다.
+    enum mmap_allocation_flag : unsigned
+    {
+        mmap_huge_page = 1u << 0,  //MADV_HUGEPAGE로 transparent huge page를 요청합니다.
+        mmap_numa_local = 1u << 1, //할당하는 thread가 지금 도는 NUMA node를 mbind(MPOL_PREFERRED)로 지정합니다.
+    };
+
+    //익명 mmap으로 직접 매핑합니다. 수 GB 단위의 큰 배열용입니다.
+    //지원하지 않는 플랫폼에서는 page 정렬 할당으로 대신합니다.
+    template <unsigned Flags = mmap_huge_page>
+    struct mmap_allocation
+    {
+        static constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+#if defined(_WIN32)
+        static constexpr bool zero_initialized = false;
+
+        static void *allocate(std::size_t bytes, std::size_t alignment)
+        {
+            return aligned_allocation<4096>::allocate(bytes, alignment);
+        }
+        static void deallocate(void *pointer, std::size_t bytes, std::size_t alignment) noexcept
+        {
+            aligned_allocation<4096>::deallocate(pointer, bytes, alignment);
+        }
+#else
+        static constexpr bool zero_initialized = true;
+
+        //huge page를 쓰면 2MB 단위로, 아니면 page 단위로 맞춥니다.
+        static std::size_t _mapping_size(std::size_t bytes)
+        {
+            std::size_t unit = (Flags & mmap_huge_page) ? huge_page_size : static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            return (bytes + unit - 1) / unit * unit;
+        }
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_getcpu)
+        //기본 정책(MPOL_DEFAULT)은 page를 처음 건드린 thread의 node에 둡니다.
+        //할당한 thread의 node로 고정해 두어야 다른 thread가 먼저 채워도 여기로 옵니다.
+        //MPOL_PREFERRED라 그 node가 가득 차면 다른 node에서 받아옵니다. 실패하면 errno를 돌려줍니다.
+        static int _bind_to_current_node(void *begin, std::size_t length) noexcept
+        {
+            unsigned cpu = 0, node = 0;
+            if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+                return errno;
+
+            const int mpol_preferred = 1; //<numaif.h>의 MPOL_PREFERRED, libnuma 없이 syscall로 호출합니다.
+            const std::size_t word_bits = sizeof(unsigned long) * 8;
+            unsigned long mask[16] = {};
+            if (node >= sizeof(mask) * 8)
+                return EINVAL;
+            mask[node / word_bits] = 1ul << (node % word_bits);
+
+            //kernel은 maxnode에서 1을 빼고 읽으므로 bit 수보다 하나 크게 넘깁니다.
+            if (syscall(SYS_mbind, begin, length, mpol_preferred, mask, (node / word_bits + 1) * word_bits + 1, 0) != 0)
+                return errno;
+            return 0;
+        }
+#endif
+
+        static void *allocate(std::size_t bytes, std::size_t)
+        {
+            std::size_t length = _mapping_size(bytes);
+            //huge page 경계에 맞추기 위해 한 단위를 더 잡았다가 앞뒤를 잘라냅니다.
+            std::size_t reserved = (Flags & mmap_huge_page) ? length + huge_page_size : length;
+
+            void *mapped = mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped == MAP_FAILED)
+                throw std::bad_alloc();
+
+            char *begin = static_cast<char *>(mapped);
+            if (Flags & mmap_huge_page)
+            {
+                std::size_t address = reinterpret_cast<std::size_t>(begin);
+                char *aligned = begin + (huge_page_size - address % huge_page_size) % huge_page_size;
+
+                if (aligned != begin)
+                    munmap(begin, aligned - begin);
+                if (aligned + length != begin + reserved)
+                    munmap(aligned + length, begin + reserved - (aligned + length));
+                begin = aligned;
+
+#if defined(MADV_HUGEPAGE)
+                madvise(begin, length, MADV_HUGEPAGE); //실패해도 일반 page로 동작합니다.
+#endif
+            }
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_getcpu)
+            if (Flags & mmap_numa_local)
+            {
+                //NUMA를 끄고 빌드한 kernel(ENOSYS)은 node가 하나뿐이므로 그대로 씁니다.
+                //그 외의 실패(seccomp의 EPERM 등)는 요청한 배치를 보장할 수 없으므로 알립니다.
+                int error = _bind_to_current_node(begin, length);
+                if (error != 0 && error != ENOSYS)
+                {
+                    munmap(begin, length);
+                    throw std::system_error(error, std::generic_category(), "mmap_allocation: mbind");
+                }
+            }
+#endif
+
+            return begin;
+        }
+        static void deallocate(void *pointer, std::size_t bytes, std::size_t) noexcept
+        {
+            if (pointer != nullptr)
+                munmap(pointer, _mapping_size(bytes));
+        }
+#endif
+    };
+
+    using huge_page_allocation = mmap_allocation<mmap_huge_page>;
+    using numa_local_allocation = mmap_allocation<mmap_numa_local>;
+    using numa_local_huge_page_allocation = mmap_allocation<mmap_huge_page | mmap_numa_local>;
+} // namespace xstl
+
+#endif
@@ -5,16 +5,29 @@
     Runtime Fixed Length Array.
     Flexibility of use is lower than std::vector. 
     But memory efficiency is much better.
+    Memory comes from the Allocation policy (see allocation_policy.h).
 */
 
 #include <stdexcept>
 #include <utility>
 #include <iterator>
+#include <memory>      //uninitialized_fill, uninitialized_copy
+#include <algorithm>   //copy
+#include <cstring>     //memcpy, memset
+#include <new>
+#include <type_traits>
+#include <initializer_list>
+#include "./allocation_policy.h"
 
 namespace xstl
 {
+    //요소를 초기화하지 않고 만들 때 쓰는 tag입니다. 덮어쓸 버퍼용입니다.
+    struct for_overwrite_t
+    {
+    };
+    constexpr for_overwrite_t for_overwrite{};
 
-    template <class T>
+    template <class T, class Allocation = default_allocation>
     class fixed_vector
     {
     public:
@@ -28,8 +41,10 @@ namespace xstl
         using const_reference = const value_type &;
         using pointer = value_type *;
         using const_pointer = const value_type *;
-        class iterator;
-        class const_iterator;
+        using allocation_type = Allocation;
+        //pointer iterator는 std 알고리즘이 memmove/vectorize 경로를 탈 수 있게 해 줍니다.
+        using iterator = pointer;
+        using const_iterator = const_pointer;
         using reverse_iterator = std::reverse_iterator<fixed_vector::iterator>;
         using const_reverse_iterator = std::reverse_iterator<fixed_vector::const_iterator>;
 
@@ -37,53 +52,159 @@ namespace xstl
         T *_array = nullptr;
         size_type _length = 0;
 
-    public:
-        fixed_vector(size_type length, const_reference value = value_type()) : _array(new value_type[length]), _length(length)
+    private: //raw storage helper
+        static pointer _allocate(size_type length)
+        {
+            if (length == 0)
+                return nullptr;
+            return static_cast<pointer>(Allocation::allocate(length * sizeof(value_type), alignof(value_type)));
+        }
+        //메모리만 반환합니다. 요소는 이미 파괴되었거나 만들어지지 않은 상태여야 합니다.
+        void _deallocate() noexcept
         {
-            for (int i = 0; i < this->_length; i++)
-                _array[i] = value;
+            if (this->_array != nullptr)
+                Allocation::deallocate(this->_array, this->_length * sizeof(value_type), alignof(value_type));
+            this->_array = nullptr;
+            this->_length = 0;
         }
 
-        fixed_vector(std::initializer_list<value_type> init) : _array(new value_type[init.size()]), _length(init.size())
+        //요소를 파괴하고 메모리를 반환합니다.
+        void _destroy() noexcept
         {
-            int i = 0;
-            for (auto &&e : init)
+            if (this->_array == nullptr)
+                return;
+
+            if (!std::is_trivially_destructible<value_type>::value)
+                for (size_type i = 0; i < this->_length; i++)
+                    this->_array[i].~value_type();
+
+            this->_deallocate();
+        }
+
+        //모든 byte가 같은 값이면 memset으로 채울 수 있습니다.
+        static bool _is_byte_pattern(const_reference value)
+        {
+            auto bytes = reinterpret_cast<const unsigned char *>(&value);
+            for (size_type i = 1; i < sizeof(value_type); i++)
+                if (bytes[i] != bytes[0])
+                    return false;
+            return true;
+        }
+
+        //할당된 빈 공간에 value를 채웁니다. 실패하면 메모리를 반환합니다.
+        void _construct_fill(const_reference value)
+        {
+            //길이가 0이면 _array가 nullptr이라 memset에 넘길 수 없습니다.
+            if (this->_length == 0)
+                return;
+            if (std::is_trivially_copyable<value_type>::value && _is_byte_pattern(value))
             {
-                _array[i] = e;
-                i++;
+                //새로 매핑된 page는 이미 0이므로 건드리지 않습니다. (page를 실제로 잡지 않습니다)
+                if (Allocation::zero_initialized && *reinterpret_cast<const unsigned char *>(&value) == 0)
+                    return;
+
+                std::memset(static_cast<void *>(this->_array), *reinterpret_cast<const unsigned char *>(&value), this->_length * sizeof(value_type));
+                return;
+            }
+
+            try
+            {
+                std::uninitialized_fill(this->_array, this->_array + this->_length, value);
+            }
+            catch (...)
+            {
+                this->_deallocate();
+                throw;
             }
         }
 
+        //할당된 빈 공간에 [begin, end)를 복사합니다. 실패하면 메모리를 반환합니다.
         template <class InputIterator>
-        fixed_vector(InputIterator begin, InputIterator end) : _length(std::distance(begin, end))
+        void _construct_copy(InputIterator begin, InputIterator end)
+        {
+            try
+            {
+                std::uninitialized_copy(begin, end, this->_array);
+            }
+            catch (...)
+            {
+                this->_deallocate();
+                throw;
+            }
+        }
+        void _construct_copy(const_pointer begin, const_pointer end)
+        {
+            if (std::is_trivially_copyable<value_type>::value)
+            {
+                if (begin != end)
+                    std::memcpy(static_cast<void *>(this->_array), begin, (end - begin) * sizeof(value_type));
+                return;
+            }
+
+            this->_construct_copy<const_pointer>(begin, end);
+        }
+
+        //기존 요소를 정리하고 length 크기의 빈 공간을 새로 잡습니다.
+        void _reallocate(size_type length)
+        {
+            this->_destroy();
+            this->_array = _allocate(length);
+            this->_length = length;
+        }
+
+    public:
+        fixed_vector(size_type length, const_reference value = value_type()) : _array(_allocate(length)), _length(length)
         {
-            this->_array = new value_type[this->_length];
-            int i = 0;
-            for (; begin != end; begin++)
+            this->_construct_fill(value);
+        }
+
+        //trivial 타입은 초기화하지 않고, 그 외에는 기본 초기화(default-initialize)만 합니다.
+        fixed_vector(size_type length, for_overwrite_t) : _array(_allocate(length)), _length(length)
+        {
+            if (std::is_trivially_default_constructible<value_type>::value)
+                return;
+
+            size_type i = 0;
+            try
             {
-                _array[i] = *begin;
-                i++;
+                for (; i < length; i++)
+                    ::new (static_cast<void *>(this->_array + i)) value_type;
             }
+            catch (...)
+            {
+                if (!std::is_trivially_destructible<value_type>::value)
+                    for (size_type j = 0; j < i; j++)
+                        this->_array[j].~value_type();
+                this->_deallocate();
+                throw;
+            }
+        }
+
+        fixed_vector(std::initializer_list<value_type> init) : _array(_allocate(init.size())), _length(init.size())
+        {
+            this->_construct_copy(init.begin(), init.end());
+        }
+
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        fixed_vector(InputIterator begin, InputIterator end) : _length(std::distance(begin, end))
+        {
+            this->_array = _allocate(this->_length);
+            this->_construct_copy(begin, end);
         }
 
     public:
         fixed_vector() = default;
         ~fixed_vector()
         {
-            if (this->_array != nullptr)
-                delete[] this->_array;
+            this->_destroy();
         }
 
     public: //copy & move
-        fixed_vector(const Self &other)
+        fixed_vector(const Self &other) : _array(_allocate(other._length)), _length(other._length)
         {
-            this->_length = other._length;
-            this->_array = new value_type[other._length];
-
-            for (int i = 0; i < other._length; i++)
-                this->_array[i] = other._array[i];
+            this->_construct_copy(other.data(), other.data() + other._length);
         }
-        fixed_vector(Self &&other)
+        fixed_vector(Self &&other) noexcept
         {
             this->_length = other._length;
             this->_array = other._array;
@@ -92,18 +213,34 @@ namespace xstl
         }
         Self &operator=(const Self &other)
         {
-            this->clear();
+            if (this == &other)
+                return *this;
 
-            this->_length = other._length;
-            this->_array = new value_type[other._length];
+            //길이가 같으면 메모리를 다시 잡지 않고 덮어씁니다.
+            if (this->_length == other._length)
+            {
+                if (std::is_trivially_copyable<value_type>::value)
+                {
+                    if (this->_length != 0)
+                        std::memcpy(static_cast<void *>(this->_array), other._array, this->_length * sizeof(value_type));
+                }
+                else
+                    std::copy(other._array, other._array + other._length, this->_array);
 
-            for (int i = 0; i < other._length; i++)
-                this->_array[i] = other._array[i];
+                return *this;
+            }
+
+            this->_reallocate(other._length);
+            this->_construct_copy(other.data(), other.data() + other._length);
 
             return *this;
         }
-        Self &operator=(Self &&other)
+        Self &operator=(Self &&other) noexcept
         {
+            if (this == &other)
+                return *this;
+
+            this->_destroy();
             this->_length = other._length;
             this->_array = other._array;
             other._length = 0;
@@ -124,13 +261,13 @@ namespace xstl
         reference at(size_type index)
         {
             if (index >= this->_length)
-                throw std::out_of_range();
+                throw std::out_of_range("fixed_vector::at");
             return this->_array[index];
         }
         const_reference at(size_type index) const
         {
             if (index >= this->_length)
-                throw std::out_of_range();
+                throw std::out_of_range("fixed_vector::at");
             return this->_array[index];
         }
         pointer data() noexcept
@@ -155,42 +292,26 @@ namespace xstl
     public:
         void clear() noexcept
         {
-            if (this->_array != nullptr)
-            {
-                delete[] this->_array;
-                this->_length = 0;
-            }
+            this->_destroy();
         }
 
         void assign(size_type length, const_reference value = value_type())
         {
-            this->clear();
-            this->_length = length;
-            this->_array = new value_type[length];
-            for (int i = 0; i < this->_length; i++)
-                _array[i] = value;
+            //value가 자기 요소일 수 있으므로 먼저 복사해 둡니다.
+            value_type copied = value;
+            this->_reallocate(length);
+            this->_construct_fill(copied);
         }
         void assign(std::initializer_list<value_type> init)
         {
-            this->assign(init.size());
-            int i = 0;
-            for (auto &&e : init)
-            {
-                _array[i] = e;
-                i++;
-            }
+            this->_reallocate(init.size());
+            this->_construct_copy(init.begin(), init.end());
         }
-        template <class InputIterator>
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
         void assign(InputIterator begin, InputIterator end)
         {
-            this->assign(std::distance(begin, end));
-            this->_array = new value_type[this->_length];
-            int i = 0;
-            for (; begin != end; begin++)
-            {
-                _array[i] = *begin;
-                i++;
-            }
+            this->_reallocate(std::distance(begin, end));
+            this->_construct_copy(begin, end);
         }
 
         void swap(Self &other) noexcept
@@ -206,7 +327,7 @@ namespace xstl
         }
 
     public: //iterator
-        iterator begin()
+        iterator begin() noexcept
         {
             return fixed_vector::iterator(this->_array);
         }
@@ -219,7 +340,7 @@ namespace xstl
             return fixed_vector::const_iterator(this->_array);
         }
 
-        fixed_vector::iterator end()
+        fixed_vector::iterator end() noexcept
         {
             return fixed_vector::iterator(this->_array + this->_length);
         }
@@ -233,7 +354,7 @@ namespace xstl
         }
 
     public: //reverse iterator
-        fixed_vector::reverse_iterator rbegin()
+        fixed_vector::reverse_iterator rbegin() noexcept
         {
             return fixed_vector::reverse_iterator(this->end());
         }
@@ -246,7 +367,7 @@ namespace xstl
             return fixed_vector::const_reverse_iterator(this->cend());
         }
 
-        fixed_vector::reverse_iterator rend()
+        fixed_vector::reverse_iterator rend() noexcept
         {
             return fixed_vector::reverse_iterator(this->begin());
         }
@@ -258,176 +379,6 @@ namespace xstl
         {
             return fixed_vector::const_reverse_iterator(this->cbegin());
         }
-
-        class iterator
-        {
-        private:
-            pointer current;
-
-        public:
-            using Self = iterator;
-            friend const_iterator;
-
-        public:
-            using value_type = fixed_vector::value_type;
-            using pointer = fixed_vector::pointer;
-            using reference = fixed_vector::reference;
-            using difference_type = std::ptrdiff_t;
-            using iterator_category = std::random_access_iterator_tag;
-
-        public:
-            iterator() = delete;
-            virtual ~iterator() = default;
-
-        public: //move & copy member
-            iterator(const Self &) = default;
-            iterator(Self &&) = default;
-            Self &operator=(const Self &) = default;
-            Self &operator=(Self &&) = default;
-
-        public:
-            iterator(pointer p) : current(p)
-            {
-            }
-
-        public: //move operator
-            Self &operator++()
-            {
-                current++;
-                return *this;
-            }
-            Self operator++(int)
-            {
-                current++;
-                return *this;
-            }
-            Self &operator--()
-            {
-                current--;
-                return *this;
-            }
-            Self operator--(int)
-            {
-                current--;
-                return *this;
-            }
-
-        public: //access operator
-            reference operator*()
-            {
-                return *current;
-            }
-            const_reference operator*() const
-            {
-                return *current;
-            }
-            reference operator[](size_type index)
-            {
-                return current[index];
-            }
-            const_reference operator[](size_type index) const
-            {
-                return current[index];
-            }
-            pointer operator->()
-            {
-                return current;
-            }
-            const_pointer operator->() const
-            {
-                return current;
-            }
-
-        public: //comparer
-            bool operator==(const Self &other) const
-            {
-                return this->current == other.current;
-            }
-            bool operator!=(const Self &other) const
-            {
-                return this->current != other.current;
-            }
-        };
-
-        class const_iterator
-        {
-        private:
-            const_pointer current;
-
-        public:
-            using Self = const_iterator;
-
-        public:
-            using value_type = value_type;
-            using pointer = pointer;
-            using reference = reference;
-            using difference_type = std::ptrdiff_t;
-            using iterator_category = std::random_access_iterator_tag;
-
-        public:
-            const_iterator() = delete;
-            virtual ~const_iterator() = default;
-
-        public: //move & copy member
-            const_iterator(const Self &) = default;
-            const_iterator(Self &&) = default;
-            Self &operator=(const Self &) = default;
-            Self &operator=(Self &&) = default;
-
-        public:
-            const_iterator(const_pointer p) : current(p)
-            {
-            }
-            const_iterator(iterator it) : current(it.current)
-            {
-            }
-
-        public: //move operator
-            Self &operator++()
-            {
-                current++;
-                return *this;
-            }
-            Self operator++(int)
-            {
-                current++;
-                return *this;
-            }
-            Self &operator--()
-            {
-                current--;
-                return *this;
-            }
-            Self operator--(int)
-            {
-                current--;
-                return *this;
-            }
-
-        public: //access operator
-            const_reference operator*() const
-            {
-                return *current;
-            }
-            const_reference operator[](size_type index) const
-            {
-                return current[index];
-            }
-            const_pointer operator->() const
-            {
-                return current;
-            }
-
-        public: //comparer
-            bool operator==(const Self &other) const
-            {
-                return this->current == other.current;
-            }
-            bool operator!=(const Self &other) const
-            {
-                return this->current != other.current;
-            }
-        };
     };
 
 }; // namespace xstl
@@ -0,0 +1,407 @@
+#ifndef __XSTL_MAPPED_FIXED_VECTOR__
+#define __XSTL_MAPPED_FIXED_VECTOR__
+
+/*
+    Memory-Mapped Fixed Length Array.
+    Maps a file written by mapped_fixed_vector::write() without copying it into memory.
+    Only trivially copyable T can be stored. POSIX only (mmap).
+    The mapping mode is part of the type: a read_only mapping only hands out const access,
+    so a write through it is a compile error instead of a segfault on the PROT_READ pages.
+    write() builds the file under a temporary name and renames it over the target,
+    so processes that still map the old file keep reading the old contents.
+
+    File layout: 64 byte header, then length * sizeof(T) bytes of raw elements.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <atomic>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+#include <iterator>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "./fixed_vector.h"
+
+namespace xstl
+{
+    //파일 맨 앞에 오는 header입니다. 쓴 쪽과 읽는 쪽의 타입 크기, 정렬, endian을 검사합니다.
+    struct mapped_fixed_vector_header
+    {
+        static constexpr std::uint32_t current_version = 1;
+        static constexpr std::uint32_t endian_tag = 0x01020304;
+
+        char magic[8];             //"XSTLFVEC"
+        std::uint32_t version;     //current_version
+        std::uint32_t endian;      //쓴 시스템 기준 endian_tag
+        std::uint64_t value_size;  //sizeof(T)
+        std::uint64_t value_align; //alignof(T)
+        std::uint64_t length;      //요소 개수
+        std::uint64_t data_offset; //파일 시작부터 첫 요소까지의 byte 수
+        std::uint8_t reserved[16];
+    };
+    static_assert(sizeof(mapped_fixed_vector_header) == 64, "header must stay 64 bytes");
+
+    enum class mapped_mode
+    {
+        read_only,     //PROT_READ, MAP_SHARED
+        copy_on_write, //PROT_READ | PROT_WRITE, MAP_PRIVATE. 수정은 파일에 반영되지 않습니다.
+    };
+
+    template <class T, mapped_mode Mode = mapped_mode::read_only>
+    class mapped_fixed_vector
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "mapped_fixed_vector requires a trivially copyable type");
+
+    public:
+        using Self = mapped_fixed_vector;
+
+        //copy_on_write일 때만 요소를 고칠 수 있습니다. read_only면 reference, pointer, iterator가 모두 const입니다.
+        static constexpr bool writable = Mode == mapped_mode::copy_on_write;
+
+    public: //stl standard type member
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename std::conditional<writable, value_type &, const value_type &>::type;
+        using const_reference = const value_type &;
+        using pointer = typename std::conditional<writable, value_type *, const value_type *>::type;
+        using const_pointer = const value_type *;
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using header_type = mapped_fixed_vector_header;
+
+    private:
+        void *_mapping = nullptr;
+        size_type _mapping_size = 0;
+        pointer _array = nullptr;
+        size_type _length = 0;
+
+    private:
+        static std::uint64_t _data_offset()
+        {
+            //header 뒤를 T의 정렬과 cache line에 맞춥니다.
+            return alignof(value_type) > 64 ? alignof(value_type) : 64;
+        }
+
+        static void _check_header(const header_type &header, size_type file_size)
+        {
+            if (std::memcmp(header.magic, "XSTLFVEC", sizeof(header.magic)) != 0)
+                throw std::runtime_error("mapped_fixed_vector: not a fixed_vector file");
+            if (header.endian != header_type::endian_tag)
+                throw std::runtime_error("mapped_fixed_vector: endianness mismatch");
+            if (header.version != header_type::current_version)
+                throw std::runtime_error("mapped_fixed_vector: unsupported version");
+            if (header.value_size != sizeof(value_type) || header.value_align != alignof(value_type))
+                throw std::runtime_error("mapped_fixed_vector: element type size/alignment mismatch");
+            if (header.data_offset % alignof(value_type) != 0 || header.data_offset < sizeof(header_type))
+                throw std::runtime_error("mapped_fixed_vector: misaligned data offset");
+            //아래 뺄셈이 넘치지 않도록 offset이 파일 안에 있는지 먼저 봅니다.
+            if (header.data_offset > file_size)
+                throw std::runtime_error("mapped_fixed_vector: file is truncated");
+            if (header.length > (file_size - header.data_offset) / sizeof(value_type))
+                throw std::runtime_error("mapped_fixed_vector: file is truncated");
+        }
+
+        void _unmap() noexcept
+        {
+            if (this->_mapping != nullptr)
+                munmap(this->_mapping, this->_mapping_size);
+            this->_mapping = nullptr;
+            this->_mapping_size = 0;
+            this->_array = nullptr;
+            this->_length = 0;
+        }
+
+    public:
+        mapped_fixed_vector() = default;
+        ~mapped_fixed_vector()
+        {
+            this->_unmap();
+        }
+
+        explicit mapped_fixed_vector(const std::string &path)
+        {
+            this->open(path);
+        }
+
+    public: //move only
+        mapped_fixed_vector(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+        mapped_fixed_vector(Self &&other) noexcept
+        {
+            this->swap(other);
+        }
+        Self &operator=(Self &&other) noexcept
+        {
+            if (this != &other)
+            {
+                this->_unmap();
+                this->swap(other);
+            }
+            return *this;
+        }
+
+    public:
+        void open(const std::string &path)
+        {
+            this->_unmap();
+
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                throw std::system_error(errno, std::generic_category(), "mapped_fixed_vector: open " + path);
+
+            struct stat status;
+            if (fstat(fd, &status) != 0)
+            {
+                int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "mapped_fixed_vector: fstat " + path);
+            }
+
+            size_type file_size = static_cast<size_type>(status.st_size);
+            if (file_size < sizeof(header_type))
+            {
+                ::close(fd);
+                throw std::runtime_error("mapped_fixed_vector: file is smaller than the header");
+            }
+
+            int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+            int flags = writable ? MAP_PRIVATE : MAP_SHARED;
+            void *mapping = mmap(nullptr, file_size, protection, flags, fd, 0);
+            int error = errno;
+            ::close(fd); //mapping은 fd를 닫아도 유지됩니다.
+
+            if (mapping == MAP_FAILED)
+                throw std::system_error(error, std::generic_category(), "mapped_fixed_vector: mmap " + path);
+
+            auto header = static_cast<const header_type *>(mapping);
+            try
+            {
+                _check_header(*header, file_size);
+            }
+            catch (...)
+            {
+                munmap(mapping, file_size);
+                throw;
+            }
+
+            this->_mapping = mapping;
+            this->_mapping_size = file_size;
+            this->_array = reinterpret_cast<pointer>(static_cast<char *>(mapping) + header->data_offset);
+            this->_length = static_cast<size_type>(header->length);
+        }
+
+        //앞으로 읽을 범위를 미리 page cache에 올리도록 요청합니다.
+        void prefetch() const noexcept
+        {
+            if (this->_mapping != nullptr)
+                madvise(this->_mapping, this->_mapping_size, MADV_WILLNEED);
+        }
+
+    private:
+        //path 옆에 겹치지 않는 이름으로 파일을 만듭니다. 권한은 fopen처럼 umask를 따르고, 대상이 있으면 그 권한을 이어받습니다.
+        static int _create_temporary(const std::string &path, std::string &temporary)
+        {
+            static std::atomic<unsigned> counter{0};
+            for (int attempt = 0; attempt < 100; attempt++)
+            {
+                temporary = path + ".tmp." + std::to_string(getpid()) + "." + std::to_string(counter.fetch_add(1));
+                int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+                if (fd < 0)
+                {
+                    int error = errno;
+                    if (error == EEXIST)
+                        continue;
+                    throw std::system_error(error, std::generic_category(), "mapped_fixed_vector: open " + temporary);
+                }
+
+                struct stat status;
+                if (::stat(path.c_str(), &status) == 0)
+                    fchmod(fd, status.st_mode & 07777); //실패해도 umask 기본 권한으로 남습니다.
+                return fd;
+            }
+            throw std::runtime_error("mapped_fixed_vector: no free temporary name for " + path);
+        }
+
+    public: //writer
+        //data[0, length)를 mapped_fixed_vector가 읽을 수 있는 형식으로 저장합니다.
+        static void write(const std::string &path, const_pointer data, size_type length)
+        {
+            header_type header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, "XSTLFVEC", sizeof(header.magic));
+            header.version = header_type::current_version;
+            header.endian = header_type::endian_tag;
+            header.value_size = sizeof(value_type);
+            header.value_align = alignof(value_type);
+            header.length = length;
+            header.data_offset = _data_offset();
+
+            //같은 directory의 임시 파일에 다 쓴 뒤 rename으로 바꿔 끼웁니다.
+            //제자리에서 truncate하면 그 파일을 매핑한 다른 process가 SIGBUS를 받습니다.
+            std::string temporary;
+            int fd = _create_temporary(path, temporary);
+            std::FILE *file = fdopen(fd, "wb");
+            if (file == nullptr)
+            {
+                int error = errno;
+                ::close(fd);
+                ::unlink(temporary.c_str());
+                throw std::system_error(error, std::generic_category(), "mapped_fixed_vector: fdopen " + temporary);
+            }
+
+            static const char padding[64] = {};
+            bool written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+            for (size_type remain = header.data_offset - sizeof(header); written && remain > 0;)
+            {
+                size_type chunk = remain < sizeof(padding) ? remain : sizeof(padding);
+                written = std::fwrite(padding, 1, chunk, file) == chunk;
+                remain -= chunk;
+            }
+            written = written && (length == 0 || std::fwrite(data, sizeof(value_type), length, file) == length);
+            //rename 뒤에 내용이 비어 보이지 않도록 디스크에 내린 다음 바꿉니다.
+            written = written && std::fflush(file) == 0 && fsync(fileno(file)) == 0;
+            bool closed = std::fclose(file) == 0;
+
+            if (!written || !closed)
+            {
+                ::unlink(temporary.c_str());
+                throw std::runtime_error("mapped_fixed_vector: failed to write " + path);
+            }
+            if (std::rename(temporary.c_str(), path.c_str()) != 0)
+            {
+                int error = errno;
+                ::unlink(temporary.c_str());
+                throw std::system_error(error, std::generic_category(), "mapped_fixed_vector: rename to " + path);
+            }
+        }
+        template <class Allocation>
+        static void write(const std::string &path, const fixed_vector<value_type, Allocation> &vector)
+        {
+            write(path, vector.data(), vector.size());
+        }
+
+    public:
+        reference operator[](size_type index)
+        {
+            return this->_array[index];
+        }
+        const_reference operator[](size_type index) const
+        {
+            return this->_array[index];
+        }
+        const_reference at(size_type index) const
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("mapped_fixed_vector::at");
+            return this->_array[index];
+        }
+        pointer data() noexcept
+        {
+            return this->_array;
+        }
+        const_pointer data() const noexcept
+        {
+            return this->_array;
+        }
+
+    public:
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+        bool is_open() const noexcept
+        {
+            return this->_mapping != nullptr;
+        }
+        static constexpr mapped_mode mode() noexcept
+        {
+            return Mode;
+        }
+
+    public:
+        void close() noexcept
+        {
+            this->_unmap();
+        }
+
+        void swap(Self &other) noexcept
+        {
+            std::swap(this->_mapping, other._mapping);
+            std::swap(this->_mapping_size, other._mapping_size);
+            std::swap(this->_array, other._array);
+            std::swap(this->_length, other._length);
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            return this->_array;
+        }
+        const_iterator begin() const noexcept
+        {
+            return this->_array;
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return this->_array;
+        }
+        iterator end() noexcept
+        {
+            return this->_array + this->_length;
+        }
+        const_iterator end() const noexcept
+        {
+            return this->_array + this->_length;
+        }
+        const_iterator cend() const noexcept
+        {
+            return this->_array + this->_length;
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return this->crbegin();
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(this->cend());
+        }
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rend() const noexcept
+        {
+            return this->crend();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(this->cbegin());
+        }
+    };
+} // namespace xstl
+
+#endif
@@ -0,0 +1,752 @@
+#ifndef __XSTL_PACKED_FIXED_VECTOR__
+#define __XSTL_PACKED_FIXED_VECTOR__
+
+/*
+    Runtime Fixed Length Bit-Packed Array.
+    Stores Bits-wide unsigned integers (bool when Bits == 1) in 64 bit words,
+    so 10^9 flags take 125 MB instead of 1 GB.
+    Elements are accessed through proxy references.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <iterator>
+#include <utility>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+#include "./fixed_vector.h"
+#include "./allocation_policy.h"
+#include "../utility/bit_operation.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace xstl
+{
+    //Bits를 담을 수 있는 가장 작은 unsigned 타입입니다.
+    template <std::size_t Bits>
+    struct _packed_value_type
+    {
+        using type = typename std::conditional<
+            Bits <= 8, std::uint8_t,
+            typename std::conditional<
+                Bits <= 16, std::uint16_t,
+                typename std::conditional<Bits <= 32, std::uint32_t, std::uint64_t>::type>::type>::type;
+    };
+    template <>
+    struct _packed_value_type<1>
+    {
+        using type = bool;
+    };
+
+    //Bits는 64의 약수여야 합니다. 요소가 word 경계에 걸치지 않게 하기 위함입니다.
+    template <std::size_t Bits, class Allocation = aligned_allocation<64>>
+    class packed_fixed_vector
+    {
+        static_assert(Bits != 0 && 64 % Bits == 0, "Bits must be one of 1, 2, 4, 8, 16, 32, 64");
+
+    public:
+        using Self = packed_fixed_vector;
+
+    public: //stl standard type member
+        using value_type = typename _packed_value_type<Bits>::type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using word_type = std::uint64_t;
+        using allocation_type = Allocation;
+        class reference;
+        using const_reference = value_type;
+        class iterator;
+        class const_iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type bits_per_value = Bits;
+        static constexpr size_type values_per_word = 64 / Bits;
+
+    private:
+        static constexpr word_type _value_mask = Bits == 64 ? ~word_type(0) : (word_type(1) << (Bits % 64)) - 1;
+
+        fixed_vector<word_type, Allocation> _words;
+        size_type _length = 0;
+
+    private:
+        static size_type _word_count(size_type length) noexcept
+        {
+            return (length + values_per_word - 1) / values_per_word;
+        }
+
+        //각 요소의 최하위 bit만 1인 mask입니다. (Bits == 4 -> 0x1111...)
+        static constexpr word_type _low_lane_mask() noexcept
+        {
+            return ~word_type(0) / _value_mask;
+        }
+
+        //value를 모든 lane에 복제한 word입니다.
+        static word_type _broadcast(value_type value) noexcept
+        {
+            return _low_lane_mask() * (static_cast<word_type>(value) & _value_mask);
+        }
+
+        //lane 안의 bit를 OR로 접어 0이 아닌 lane의 최하위 bit만 1로 남깁니다.
+        static word_type _fold_lanes(word_type word) noexcept
+        {
+            for (size_type shift = 1; shift < Bits; shift <<= 1)
+                word |= word >> shift;
+            return word & _low_lane_mask();
+        }
+
+        //마지막 word에서 실제 요소가 있는 bit만 1인 mask입니다.
+        word_type _tail_mask() const noexcept
+        {
+            size_type used = (this->_length % values_per_word) * Bits;
+            return used == 0 ? ~word_type(0) : (word_type(1) << used) - 1;
+        }
+
+        //사용하지 않는 꼬리 bit는 항상 0으로 유지합니다. count와 비교가 이 가정에 의존합니다.
+        void _clear_tail() noexcept
+        {
+            if (!this->_words.empty())
+                this->_words[this->_words.size() - 1] &= this->_tail_mask();
+        }
+
+        value_type _get(size_type index) const noexcept
+        {
+            word_type word = this->_words[index / values_per_word];
+            return static_cast<value_type>((word >> (index % values_per_word * Bits)) & _value_mask);
+        }
+        void _set(size_type index, value_type value) noexcept
+        {
+            word_type &word = this->_words[index / values_per_word];
+            size_type shift = index % values_per_word * Bits;
+            word = (word & ~(_value_mask << shift)) | ((static_cast<word_type>(value) & _value_mask) << shift);
+        }
+
+        void _fill(value_type value) noexcept
+        {
+            word_type pattern = _broadcast(value);
+            for (size_type i = 0; i < this->_words.size(); i++)
+                this->_words[i] = pattern;
+            this->_clear_tail();
+        }
+
+        template <class InputIterator>
+        void _assign_range(InputIterator begin, size_type length)
+        {
+            this->_words = fixed_vector<word_type, Allocation>(_word_count(length), word_type(0));
+            this->_length = length;
+            for (size_type i = 0; i < length; i++, ++begin)
+                this->_set(i, static_cast<value_type>(*begin));
+        }
+
+    private: //bulk kernel
+        struct _and_op
+        {
+            static word_type word(word_type a, word_type b) noexcept
+            {
+                return a & b;
+            }
+#if defined(__AVX2__)
+            static __m256i vector(__m256i a, __m256i b) noexcept
+            {
+                return _mm256_and_si256(a, b);
+            }
+#endif
+        };
+        struct _or_op
+        {
+            static word_type word(word_type a, word_type b) noexcept
+            {
+                return a | b;
+            }
+#if defined(__AVX2__)
+            static __m256i vector(__m256i a, __m256i b) noexcept
+            {
+                return _mm256_or_si256(a, b);
+            }
+#endif
+        };
+        struct _xor_op
+        {
+            static word_type word(word_type a, word_type b) noexcept
+            {
+                return a ^ b;
+            }
+#if defined(__AVX2__)
+            static __m256i vector(__m256i a, __m256i b) noexcept
+            {
+                return _mm256_xor_si256(a, b);
+            }
+#endif
+        };
+
+        template <class Operation>
+        void _bitwise(const Self &other)
+        {
+            if (this->_length != other._length)
+                throw std::invalid_argument("packed_fixed_vector: length mismatch");
+
+            word_type *destination = this->_words.data();
+            const word_type *source = other._words.data();
+            size_type count = this->_words.size();
+            size_type i = 0;
+#if defined(__AVX2__)
+            for (; i + 4 <= count; i += 4)
+            {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(destination + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), Operation::vector(a, b));
+            }
+#endif
+            for (; i < count; i++)
+                destination[i] = Operation::word(destination[i], source[i]);
+        }
+
+    public:
+        explicit packed_fixed_vector(size_type length, value_type value = value_type()) : _words(_word_count(length), for_overwrite), _length(length)
+        {
+            this->_fill(value);
+        }
+
+        //요소 값은 정해지지 않습니다. 꼬리 bit만 0으로 맞춥니다.
+        packed_fixed_vector(size_type length, for_overwrite_t) : _words(_word_count(length), for_overwrite), _length(length)
+        {
+            if (!this->_words.empty())
+                this->_words[this->_words.size() - 1] = 0;
+        }
+
+        packed_fixed_vector(std::initializer_list<value_type> init)
+        {
+            this->_assign_range(init.begin(), init.size());
+        }
+
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        packed_fixed_vector(InputIterator begin, InputIterator end)
+        {
+            std::vector<value_type> buffer(begin, end);
+            this->_assign_range(buffer.begin(), buffer.size());
+        }
+
+    public:
+        packed_fixed_vector() = default;
+        ~packed_fixed_vector() = default;
+
+    public: //copy & move
+        packed_fixed_vector(const Self &) = default;
+        Self &operator=(const Self &) = default;
+        packed_fixed_vector(Self &&other) noexcept : _words(std::move(other._words)), _length(other._length)
+        {
+            other._length = 0;
+        }
+        Self &operator=(Self &&other) noexcept
+        {
+            this->_words = std::move(other._words);
+            this->_length = other._length;
+            other._length = 0;
+            return *this;
+        }
+
+    public:
+        reference operator[](size_type index)
+        {
+            return reference(this, index);
+        }
+        const_reference operator[](size_type index) const
+        {
+            return this->_get(index);
+        }
+        reference at(size_type index)
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("packed_fixed_vector::at");
+            return reference(this, index);
+        }
+        const_reference at(size_type index) const
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("packed_fixed_vector::at");
+            return this->_get(index);
+        }
+
+        //packed word 배열입니다. word i의 하위 bit부터 요소 i * values_per_word, ... 순서로 들어 있습니다.
+        word_type *data() noexcept
+        {
+            return this->_words.data();
+        }
+        const word_type *data() const noexcept
+        {
+            return this->_words.data();
+        }
+        size_type word_count() const noexcept
+        {
+            return this->_words.size();
+        }
+
+    public:
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+
+    public: //word-level query
+        //0이 아닌 요소 수입니다. Bits == 1이면 켜진 bit 수입니다.
+        size_type count() const noexcept
+        {
+            size_type result = 0;
+            const word_type *words = this->_words.data();
+            for (size_type i = 0; i < this->_words.size(); i++)
+                result += _popcount64(Bits == 1 ? words[i] : _fold_lanes(words[i]));
+            return result;
+        }
+        //value와 같은 요소 수입니다.
+        size_type count(value_type value) const noexcept
+        {
+            if ((static_cast<word_type>(value) & _value_mask) == 0)
+                return this->_length - this->count();
+
+            word_type pattern = _broadcast(value);
+            size_type different = 0;
+            const word_type *words = this->_words.data();
+            for (size_type i = 0; i < this->_words.size(); i++)
+                different += _popcount64(_fold_lanes(words[i] ^ pattern));
+
+            //꼬리의 빈 lane은 0이므로 모두 다르다고 세어졌습니다.
+            size_type padding = this->_words.size() * values_per_word - this->_length;
+            return this->_length - (different - padding);
+        }
+
+        //0이 아닌 첫 요소의 위치입니다. 없으면 size()를 돌려줍니다.
+        size_type find_first() const noexcept
+        {
+            return this->_find_from_word(0, ~word_type(0));
+        }
+        //position 뒤에서 0이 아닌 첫 요소의 위치입니다. 없으면 size()를 돌려줍니다.
+        size_type find_next(size_type position) const noexcept
+        {
+            size_type next = position + 1;
+            if (next >= this->_length)
+                return this->_length;
+
+            size_type shift = next % values_per_word * Bits;
+            return this->_find_from_word(next / values_per_word, ~word_type(0) << shift);
+        }
+
+    private:
+        size_type _find_from_word(size_type word_index, word_type first_mask) const noexcept
+        {
+            const word_type *words = this->_words.data();
+            for (size_type i = word_index; i < this->_words.size(); i++)
+            {
+                word_type word = Bits == 1 ? words[i] : _fold_lanes(words[i]);
+                if (i == word_index)
+                    word &= first_mask;
+                if (word != 0)
+                    return i * values_per_word + _count_trailing_zero64(word) / Bits;
+            }
+            return this->_length;
+        }
+
+    public: //bulk operation
+        //길이가 다르면 std::invalid_argument를 던집니다.
+        Self &operator&=(const Self &other)
+        {
+            this->_bitwise<_and_op>(other);
+            return *this;
+        }
+        Self &operator|=(const Self &other)
+        {
+            this->_bitwise<_or_op>(other);
+            return *this;
+        }
+        Self &operator^=(const Self &other)
+        {
+            this->_bitwise<_xor_op>(other);
+            return *this;
+        }
+        //모든 bit를 뒤집습니다.
+        void flip() noexcept
+        {
+            for (size_type i = 0; i < this->_words.size(); i++)
+                this->_words[i] = ~this->_words[i];
+            this->_clear_tail();
+        }
+
+        bool operator==(const Self &other) const noexcept
+        {
+            if (this->_length != other._length)
+                return false;
+            for (size_type i = 0; i < this->_words.size(); i++)
+                if (this->_words[i] != other._words[i])
+                    return false;
+            return true;
+        }
+        bool operator!=(const Self &other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+    public:
+        void clear() noexcept
+        {
+            this->_words.clear();
+            this->_length = 0;
+        }
+
+        void assign(size_type length, value_type value = value_type())
+        {
+            this->_words = fixed_vector<word_type, Allocation>(_word_count(length), for_overwrite);
+            this->_length = length;
+            this->_fill(value);
+        }
+        void assign(std::initializer_list<value_type> init)
+        {
+            this->_assign_range(init.begin(), init.size());
+        }
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        void assign(InputIterator begin, InputIterator end)
+        {
+            std::vector<value_type> buffer(begin, end);
+            this->_assign_range(buffer.begin(), buffer.size());
+        }
+
+        void swap(Self &other) noexcept
+        {
+            this->_words.swap(other._words);
+            std::swap(this->_length, other._length);
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            return iterator(this, 0);
+        }
+        const_iterator begin() const noexcept
+        {
+            return this->cbegin();
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return const_iterator(this, 0);
+        }
+        iterator end() noexcept
+        {
+            return iterator(this, this->_length);
+        }
+        const_iterator end() const noexcept
+        {
+            return this->cend();
+        }
+        const_iterator cend() const noexcept
+        {
+            return const_iterator(this, this->_length);
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return this->crbegin();
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(this->cend());
+        }
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rend() const noexcept
+        {
+            return this->crend();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(this->cbegin());
+        }
+
+    public:
+        //요소 하나를 가리키는 proxy입니다. value_type으로 읽고, value_type을 대입해 씁니다.
+        class reference
+        {
+        private:
+            packed_fixed_vector *owner;
+            size_type index;
+
+            friend packed_fixed_vector;
+            reference(packed_fixed_vector *o, size_type i) noexcept : owner(o), index(i)
+            {
+            }
+
+        public:
+            reference(const reference &) = default;
+
+            operator value_type() const noexcept
+            {
+                return owner->_get(index);
+            }
+            reference &operator=(value_type value) noexcept
+            {
+                owner->_set(index, value);
+                return *this;
+            }
+            reference &operator=(const reference &other) noexcept
+            {
+                owner->_set(index, static_cast<value_type>(other));
+                return *this;
+            }
+            void flip() noexcept
+            {
+                owner->_set(index, static_cast<value_type>(~static_cast<word_type>(owner->_get(index)) & _value_mask));
+            }
+
+            friend void swap(reference a, reference b) noexcept
+            {
+                value_type temp = a;
+                a = static_cast<value_type>(b);
+                b = temp;
+            }
+        };
+
+        class iterator
+        {
+        private:
+            packed_fixed_vector *owner;
+            size_type index;
+
+        public:
+            using Self = iterator;
+            friend const_iterator;
+
+        public:
+            using value_type = packed_fixed_vector::value_type;
+            using reference = packed_fixed_vector::reference;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+
+        public:
+            iterator() : owner(nullptr), index(0)
+            {
+            }
+            iterator(packed_fixed_vector *o, size_type i) : owner(o), index(i)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                index++;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                index++;
+                return temp;
+            }
+            Self &operator--()
+            {
+                index--;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                index--;
+                return temp;
+            }
+            Self &operator+=(difference_type n)
+            {
+                index += n;
+                return *this;
+            }
+            Self &operator-=(difference_type n)
+            {
+                index -= n;
+                return *this;
+            }
+            Self operator+(difference_type n) const
+            {
+                return Self(owner, index + n);
+            }
+            friend Self operator+(difference_type n, const Self &it)
+            {
+                return it + n;
+            }
+            Self operator-(difference_type n) const
+            {
+                return Self(owner, index - n);
+            }
+            difference_type operator-(const Self &other) const
+            {
+                return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                return (*owner)[index];
+            }
+            reference operator[](difference_type n) const
+            {
+                return (*owner)[index + n];
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->index == other.index;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->index != other.index;
+            }
+            bool operator<(const Self &other) const
+            {
+                return this->index < other.index;
+            }
+            bool operator>(const Self &other) const
+            {
+                return this->index > other.index;
+            }
+            bool operator<=(const Self &other) const
+            {
+                return this->index <= other.index;
+            }
+            bool operator>=(const Self &other) const
+            {
+                return this->index >= other.index;
+            }
+        };
+
+        class const_iterator
+        {
+        private:
+            const packed_fixed_vector *owner;
+            size_type index;
+
+        public:
+            using Self = const_iterator;
+
+        public:
+            using value_type = packed_fixed_vector::value_type;
+            using reference = packed_fixed_vector::const_reference;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+
+        public:
+            const_iterator() : owner(nullptr), index(0)
+            {
+            }
+            const_iterator(const packed_fixed_vector *o, size_type i) : owner(o), index(i)
+            {
+            }
+            const_iterator(const iterator &mutable_iterator) : owner(mutable_iterator.owner), index(mutable_iterator.index)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                index++;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                index++;
+                return temp;
+            }
+            Self &operator--()
+            {
+                index--;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                index--;
+                return temp;
+            }
+            Self &operator+=(difference_type n)
+            {
+                index += n;
+                return *this;
+            }
+            Self &operator-=(difference_type n)
+            {
+                index -= n;
+                return *this;
+            }
+            Self operator+(difference_type n) const
+            {
+                return Self(owner, index + n);
+            }
+            friend Self operator+(difference_type n, const Self &it)
+            {
+                return it + n;
+            }
+            Self operator-(difference_type n) const
+            {
+                return Self(owner, index - n);
+            }
+            difference_type operator-(const Self &other) const
+            {
+                return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                return (*owner)[index];
+            }
+            reference operator[](difference_type n) const
+            {
+                return (*owner)[index + n];
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->index == other.index;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->index != other.index;
+            }
+            bool operator<(const Self &other) const
+            {
+                return this->index < other.index;
+            }
+            bool operator>(const Self &other) const
+            {
+                return this->index > other.index;
+            }
+            bool operator<=(const Self &other) const
+            {
+                return this->index <= other.index;
+            }
+            bool operator>=(const Self &other) const
+            {
+                return this->index >= other.index;
+            }
+        };
+    };
+
+    //bool 배열용 별칭입니다.
+    template <class Allocation = aligned_allocation<64>>
+    using packed_bool_vector = packed_fixed_vector<1, Allocation>;
+} // namespace xstl
+
+#endif
@@ -0,0 +1,352 @@
+#ifndef __XSTL_SMALL_FIXED_VECTOR__
+#define __XSTL_SMALL_FIXED_VECTOR__
+
+/*
+    Runtime Fixed Length Array with Small Buffer.
+    Up to N elements are stored inside the object itself.
+    Only a longer runtime length spills to the heap.
+*/
+
+#include <stdexcept>
+#include <utility>
+#include <iterator>
+#include <memory>    //uninitialized_fill, uninitialized_copy
+#include <algorithm> //copy
+#include <new>
+#include <type_traits>
+#include <initializer_list>
+#include "./fixed_vector.h" //for_overwrite_t, default_allocation
+
+namespace xstl
+{
+    template <class T, std::size_t N>
+    class small_fixed_vector
+    {
+        static_assert(N > 0, "inline capacity must be positive");
+
+    public:
+        using Self = small_fixed_vector;
+
+    public: //stl standard type member
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type inline_capacity = N;
+
+    private:
+        typename std::aligned_storage<sizeof(value_type) * N, alignof(value_type)>::type _inline;
+        T *_array = this->_inline_data();
+        size_type _length = 0;
+
+    private: //storage helper
+        pointer _inline_data() noexcept
+        {
+            return reinterpret_cast<pointer>(&this->_inline);
+        }
+
+        //length가 N 이하면 내부 버퍼를, 아니면 heap을 씁니다.
+        void _allocate(size_type length)
+        {
+            this->_array = length <= N ? this->_inline_data()
+                                       : static_cast<pointer>(default_allocation::allocate(length * sizeof(value_type), alignof(value_type)));
+            this->_length = length;
+        }
+        void _deallocate() noexcept
+        {
+            if (!this->is_inline())
+                default_allocation::deallocate(this->_array, this->_length * sizeof(value_type), alignof(value_type));
+            this->_array = this->_inline_data();
+            this->_length = 0;
+        }
+        void _destroy() noexcept
+        {
+            if (!std::is_trivially_destructible<value_type>::value)
+                for (size_type i = 0; i < this->_length; i++)
+                    this->_array[i].~value_type();
+            this->_deallocate();
+        }
+
+        void _construct_fill(const_reference value)
+        {
+            try
+            {
+                std::uninitialized_fill(this->_array, this->_array + this->_length, value);
+            }
+            catch (...)
+            {
+                this->_deallocate();
+                throw;
+            }
+        }
+        template <class InputIterator>
+        void _construct_copy(InputIterator begin, InputIterator end)
+        {
+            try
+            {
+                std::uninitialized_copy(begin, end, this->_array);
+            }
+            catch (...)
+            {
+                this->_deallocate();
+                throw;
+            }
+        }
+
+        //other가 내부 버퍼를 쓰면 요소를 하나씩 옮기고, heap이면 포인터만 가져옵니다.
+        void _steal(Self &other)
+        {
+            if (other.is_inline())
+            {
+                this->_allocate(other._length);
+                std::uninitialized_copy(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), this->_array);
+                other._destroy();
+            }
+            else
+            {
+                this->_array = other._array;
+                this->_length = other._length;
+                other._array = other._inline_data();
+                other._length = 0;
+            }
+        }
+
+    public:
+        small_fixed_vector(size_type length, const_reference value = value_type())
+        {
+            this->_allocate(length);
+            this->_construct_fill(value);
+        }
+
+        //trivial 타입은 초기화하지 않고, 그 외에는 기본 초기화(default-initialize)만 합니다.
+        small_fixed_vector(size_type length, for_overwrite_t)
+        {
+            this->_allocate(length);
+            if (std::is_trivially_default_constructible<value_type>::value)
+                return;
+
+            size_type i = 0;
+            try
+            {
+                for (; i < length; i++)
+                    ::new (static_cast<void *>(this->_array + i)) value_type;
+            }
+            catch (...)
+            {
+                //_deallocate가 할당한 크기를 알아야 하므로 _length는 그대로 둡니다.
+                while (i != 0)
+                    this->_array[--i].~value_type();
+                this->_deallocate();
+                throw;
+            }
+        }
+
+        small_fixed_vector(std::initializer_list<value_type> init)
+        {
+            this->_allocate(init.size());
+            this->_construct_copy(init.begin(), init.end());
+        }
+
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        small_fixed_vector(InputIterator begin, InputIterator end)
+        {
+            this->_allocate(std::distance(begin, end));
+            this->_construct_copy(begin, end);
+        }
+
+    public:
+        small_fixed_vector() = default;
+        ~small_fixed_vector()
+        {
+            this->_destroy();
+        }
+
+    public: //copy & move
+        small_fixed_vector(const Self &other)
+        {
+            this->_allocate(other._length);
+            this->_construct_copy(other.begin(), other.end());
+        }
+        small_fixed_vector(Self &&other)
+        {
+            this->_steal(other);
+        }
+        Self &operator=(const Self &other)
+        {
+            if (this == &other)
+                return *this;
+
+            //길이가 같으면 공간을 다시 잡지 않고 덮어씁니다.
+            if (this->_length == other._length)
+            {
+                std::copy(other.begin(), other.end(), this->_array);
+                return *this;
+            }
+
+            this->_destroy();
+            this->_allocate(other._length);
+            this->_construct_copy(other.begin(), other.end());
+
+            return *this;
+        }
+        Self &operator=(Self &&other)
+        {
+            if (this == &other)
+                return *this;
+
+            this->_destroy();
+            this->_steal(other);
+
+            return *this;
+        }
+
+    public:
+        reference operator[](size_type index)
+        {
+            return this->_array[index];
+        }
+        const_reference operator[](size_type index) const
+        {
+            return this->_array[index];
+        }
+        reference at(size_type index)
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("small_fixed_vector::at");
+            return this->_array[index];
+        }
+        const_reference at(size_type index) const
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("small_fixed_vector::at");
+            return this->_array[index];
+        }
+        pointer data() noexcept
+        {
+            return this->_array;
+        }
+        const_pointer data() const noexcept
+        {
+            return this->_array;
+        }
+
+    public:
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+        //요소가 object 내부 버퍼에 있는지 여부입니다.
+        bool is_inline() const noexcept
+        {
+            return this->_array == reinterpret_cast<const_pointer>(&this->_inline);
+        }
+
+    public:
+        void clear() noexcept
+        {
+            this->_destroy();
+        }
+
+        void assign(size_type length, const_reference value = value_type())
+        {
+            //value가 자기 요소일 수 있으므로 먼저 복사해 둡니다.
+            value_type copied = value;
+            this->_destroy();
+            this->_allocate(length);
+            this->_construct_fill(copied);
+        }
+        void assign(std::initializer_list<value_type> init)
+        {
+            this->_destroy();
+            this->_allocate(init.size());
+            this->_construct_copy(init.begin(), init.end());
+        }
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        void assign(InputIterator begin, InputIterator end)
+        {
+            this->_destroy();
+            this->_allocate(std::distance(begin, end));
+            this->_construct_copy(begin, end);
+        }
+
+        void swap(Self &other)
+        {
+            if (!this->is_inline() && !other.is_inline())
+            {
+                std::swap(this->_array, other._array);
+                std::swap(this->_length, other._length);
+                return;
+            }
+
+            Self temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            return this->_array;
+        }
+        const_iterator begin() const noexcept
+        {
+            return this->_array;
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return this->_array;
+        }
+        iterator end() noexcept
+        {
+            return this->_array + this->_length;
+        }
+        const_iterator end() const noexcept
+        {
+            return this->_array + this->_length;
+        }
+        const_iterator cend() const noexcept
+        {
+            return this->_array + this->_length;
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return this->crbegin();
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(this->cend());
+        }
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rend() const noexcept
+        {
+            return this->crend();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(this->cbegin());
+        }
+    };
+} // namespace xstl
+
+#endif
@@ -0,0 +1,720 @@
+#ifndef __XSTL_SOA_VECTOR__
+#define __XSTL_SOA_VECTOR__
+
+/*
+    Runtime Fixed Length Structure-of-Arrays.
+    Every field is stored in its own contiguous fixed_vector column,
+    so a scan over one field only touches that field's memory.
+    Elements are accessed as tuples of references (proxy references).
+    The proxy assigns and swaps through to the columns, so std::sort and other mutating algorithms work on the iterators,
+    and std::move(*it) moves every field instead of copying it.
+*/
+
+#include <cstddef>
+#include <stdexcept>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <new>
+#include <utility>
+#include "./fixed_vector.h"
+
+namespace xstl
+{
+    //C++11에는 std::index_sequence가 없으므로 field 번호 나열용으로 씁니다.
+    template <std::size_t... I>
+    struct _soa_indices
+    {
+    };
+    template <std::size_t N, std::size_t... I>
+    struct _make_soa_indices : _make_soa_indices<N - 1, N - 1, I...>
+    {
+    };
+    template <std::size_t... I>
+    struct _make_soa_indices<0, I...>
+    {
+        using type = _soa_indices<I...>;
+    };
+
+    //*it가 돌려주는 proxy reference입니다. tuple<Fields&...>처럼 쓰이고, 대입은 가리키는 요소에 씁니다.
+    //임시 객체라서 std::swap(T&, T&)에 묶이지 않으므로 ADL로 찾히는 swap을 따로 둡니다. (std::sort, std::iter_swap용)
+    template <class... Fields>
+    class _soa_reference : public std::tuple<Fields &...>
+    {
+    public:
+        using Self = _soa_reference;
+        using tuple_type = std::tuple<Fields &...>;
+        using value_type = std::tuple<Fields...>;
+
+    private:
+        using _indices = typename _make_soa_indices<sizeof...(Fields)>::type;
+
+        //const tuple<Fields&...>에서 get해도 Fields&가 나오므로 const proxy로도 요소에 쓸 수 있습니다.
+        template <class Tuple, std::size_t... I>
+        void _assign(Tuple &&other, _soa_indices<I...>) const
+        {
+            int expand[] = {(std::get<I>(static_cast<const tuple_type &>(*this)) = std::get<I>(std::forward<Tuple>(other)), 0)...};
+            (void)expand;
+        }
+        template <std::size_t... I>
+        value_type _copy_out(_soa_indices<I...>) const
+        {
+            return value_type(std::get<I>(static_cast<const tuple_type &>(*this))...);
+        }
+        template <std::size_t... I>
+        std::tuple<Fields &&...> _move_refs(_soa_indices<I...>) const
+        {
+            return std::tuple<Fields &&...>(std::move(std::get<I>(static_cast<const tuple_type &>(*this)))...);
+        }
+
+    public:
+        using tuple_type::tuple_type;
+        _soa_reference(const Self &) = default;
+
+        //proxy는 요소를 가리킬 뿐이므로 const proxy로도 요소에 씁니다.
+        const Self &operator=(const Self &other) const
+        {
+            this->_assign(other, _indices());
+            return *this;
+        }
+        //*a = std::move(*b)는 각 field를 옮깁니다. *it는 lvalue이므로 std::move를 붙였을 때만 이 경로를 탑니다.
+        const Self &operator=(Self &&other) const
+        {
+            this->_assign(other._move_refs(_indices()), _indices());
+            return *this;
+        }
+        const Self &operator=(const value_type &value) const
+        {
+            this->_assign(value, _indices());
+            return *this;
+        }
+        const Self &operator=(value_type &&value) const
+        {
+            this->_assign(std::move(value), _indices());
+            return *this;
+        }
+        template <class... Values>
+        const Self &operator=(const std::tuple<Values...> &values) const
+        {
+            this->_assign(values, _indices());
+            return *this;
+        }
+        template <class... Values>
+        const Self &operator=(std::tuple<Values...> &&values) const
+        {
+            this->_assign(std::move(values), _indices());
+            return *this;
+        }
+
+        //value_type tmp = std::move(*it)는 각 field를 옮기고, value_type tmp = *it는 복사합니다.
+        operator value_type() const &
+        {
+            return this->_copy_out(_indices());
+        }
+        operator value_type() &&
+        {
+            return value_type(this->_move_refs(_indices()));
+        }
+
+        friend void swap(Self left, Self right)
+        {
+            static_cast<tuple_type &>(left).swap(right);
+        }
+    };
+
+    //std::reverse_iterator는 임시 iterator를 역참조하므로 iterator 안에 둔 proxy가 바로 사라집니다.
+    //그래서 요소 위치(base() - 1)의 iterator를 직접 들고 그것을 역참조합니다.
+    template <class Iterator>
+    class _soa_reverse_iterator
+    {
+    public:
+        using Self = _soa_reverse_iterator;
+        template <class>
+        friend class _soa_reverse_iterator;
+
+    public:
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+        using reference = typename std::iterator_traits<Iterator>::reference;
+        using pointer = void;
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_type = Iterator;
+
+    private:
+        Iterator element;
+
+    public:
+        _soa_reverse_iterator() = default;
+        explicit _soa_reverse_iterator(Iterator base) : element(base - 1)
+        {
+        }
+        template <class Other>
+        _soa_reverse_iterator(const _soa_reverse_iterator<Other> &other) : element(other.element)
+        {
+        }
+        Iterator base() const
+        {
+            return this->element + 1;
+        }
+
+    public: //move operator
+        Self &operator++()
+        {
+            --this->element;
+            return *this;
+        }
+        Self operator++(int)
+        {
+            Self temp = *this;
+            --this->element;
+            return temp;
+        }
+        Self &operator--()
+        {
+            ++this->element;
+            return *this;
+        }
+        Self operator--(int)
+        {
+            Self temp = *this;
+            ++this->element;
+            return temp;
+        }
+        Self &operator+=(difference_type n)
+        {
+            this->element -= n;
+            return *this;
+        }
+        Self &operator-=(difference_type n)
+        {
+            this->element += n;
+            return *this;
+        }
+        Self operator+(difference_type n) const
+        {
+            return Self(this->base() - n);
+        }
+        friend Self operator+(difference_type n, const Self &it)
+        {
+            return it + n;
+        }
+        Self operator-(difference_type n) const
+        {
+            return Self(this->base() + n);
+        }
+        difference_type operator-(const Self &other) const
+        {
+            return other.element - this->element;
+        }
+
+    public: //access operator
+        reference operator*() const
+        {
+            return *this->element;
+        }
+        auto operator[](difference_type n) const -> decltype(this->element[-n])
+        {
+            return this->element[-n];
+        }
+
+    public: //comparer
+        bool operator==(const Self &other) const
+        {
+            return this->element == other.element;
+        }
+        bool operator!=(const Self &other) const
+        {
+            return this->element != other.element;
+        }
+        bool operator<(const Self &other) const
+        {
+            return other.element < this->element;
+        }
+        bool operator>(const Self &other) const
+        {
+            return other.element > this->element;
+        }
+        bool operator<=(const Self &other) const
+        {
+            return other.element <= this->element;
+        }
+        bool operator>=(const Self &other) const
+        {
+            return other.element >= this->element;
+        }
+    };
+} // namespace xstl
+
+//structured binding(auto [a, b] = v[i])이 tuple<Fields&...>일 때처럼 동작하게 합니다.
+namespace std
+{
+    template <class... Fields>
+    struct tuple_size<xstl::_soa_reference<Fields...>> : tuple_size<tuple<Fields &...>>
+    {
+    };
+    template <size_t I, class... Fields>
+    struct tuple_element<I, xstl::_soa_reference<Fields...>> : tuple_element<I, tuple<Fields &...>>
+    {
+    };
+} // namespace std
+
+namespace xstl
+{
+    template <class... Fields>
+    class soa_vector
+    {
+        static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+    public:
+        using Self = soa_vector;
+
+    public: //stl standard type member
+        using value_type = std::tuple<Fields...>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = _soa_reference<Fields...>;
+        using const_reference = std::tuple<const Fields &...>;
+        class iterator;
+        class const_iterator;
+        using reverse_iterator = _soa_reverse_iterator<iterator>;
+        using const_reverse_iterator = _soa_reverse_iterator<const_iterator>;
+
+        template <size_type I>
+        using field_type = typename std::tuple_element<I, value_type>::type;
+        static constexpr size_type field_count = sizeof...(Fields);
+
+    private:
+        using _indices = typename _make_soa_indices<sizeof...(Fields)>::type;
+
+        std::tuple<fixed_vector<Fields>...> _columns;
+        size_type _length = 0;
+
+    private:
+        template <size_type... I>
+        reference _reference_at(size_type index, _soa_indices<I...>)
+        {
+            return reference(std::get<I>(this->_columns)[index]...);
+        }
+        template <size_type... I>
+        const_reference _reference_at(size_type index, _soa_indices<I...>) const
+        {
+            return const_reference(std::get<I>(this->_columns)[index]...);
+        }
+
+        template <size_type... I>
+        void _fill(const value_type &value, _soa_indices<I...>)
+        {
+            this->_columns = std::tuple<fixed_vector<Fields>...>(fixed_vector<Fields>(this->_length, std::get<I>(value))...);
+        }
+        template <size_type... I>
+        void _swap(Self &other, _soa_indices<I...>) noexcept
+        {
+            int expand[] = {(std::get<I>(this->_columns).swap(std::get<I>(other._columns)), 0)...};
+            (void)expand;
+        }
+
+    public:
+        soa_vector() = default;
+        ~soa_vector() = default;
+
+        explicit soa_vector(size_type length) : _columns(fixed_vector<Fields>(length)...), _length(length)
+        {
+        }
+        soa_vector(size_type length, const value_type &value) : _length(length)
+        {
+            this->_fill(value, _indices());
+        }
+        //trivial 타입 column은 초기화하지 않습니다.
+        soa_vector(size_type length, for_overwrite_t) : _columns(fixed_vector<Fields>(length, for_overwrite)...), _length(length)
+        {
+        }
+
+    public: //copy & move
+        soa_vector(const Self &) = default;
+        Self &operator=(const Self &) = default;
+        soa_vector(Self &&other) noexcept : _columns(std::move(other._columns)), _length(other._length)
+        {
+            other._length = 0;
+        }
+        Self &operator=(Self &&other) noexcept
+        {
+            this->_columns = std::move(other._columns);
+            this->_length = other._length;
+            other._length = 0;
+            return *this;
+        }
+
+    public: //element access
+        //const proxy를 돌려주므로 value_type x = v[i]는 요소를 옮기지 않고 복사합니다.
+        const reference operator[](size_type index)
+        {
+            return this->_reference_at(index, _indices());
+        }
+        const_reference operator[](size_type index) const
+        {
+            return this->_reference_at(index, _indices());
+        }
+        const reference at(size_type index)
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("soa_vector::at");
+            return this->_reference_at(index, _indices());
+        }
+        const_reference at(size_type index) const
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("soa_vector::at");
+            return this->_reference_at(index, _indices());
+        }
+
+    public: //column access
+        //I번째 field의 연속된 배열입니다. SIMD kernel에 그대로 넘길 수 있습니다.
+        template <size_type I>
+        field_type<I> *data() noexcept
+        {
+            return std::get<I>(this->_columns).data();
+        }
+        template <size_type I>
+        const field_type<I> *data() const noexcept
+        {
+            return std::get<I>(this->_columns).data();
+        }
+        template <size_type I>
+        fixed_vector<field_type<I>> &column() noexcept
+        {
+            return std::get<I>(this->_columns);
+        }
+        template <size_type I>
+        const fixed_vector<field_type<I>> &column() const noexcept
+        {
+            return std::get<I>(this->_columns);
+        }
+
+    public:
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+
+    public:
+        void clear() noexcept
+        {
+            this->_columns = std::tuple<fixed_vector<Fields>...>();
+            this->_length = 0;
+        }
+        void swap(Self &other) noexcept
+        {
+            this->_swap(other, _indices());
+            std::swap(this->_length, other._length);
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            return iterator(this, 0);
+        }
+        const_iterator begin() const noexcept
+        {
+            return this->cbegin();
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return const_iterator(this, 0);
+        }
+        iterator end() noexcept
+        {
+            return iterator(this, this->_length);
+        }
+        const_iterator end() const noexcept
+        {
+            return this->cend();
+        }
+        const_iterator cend() const noexcept
+        {
+            return const_iterator(this, this->_length);
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return this->crbegin();
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(this->cend());
+        }
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rend() const noexcept
+        {
+            return this->crend();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(this->cbegin());
+        }
+
+    public:
+        //*it는 iterator 안에 만들어 둔 proxy를 lvalue로 돌려줍니다. 그래서 std::move(*it)일 때만 요소가 옮겨지고
+        //*d = *s나 value_type x = *it는 복사합니다. 돌려받은 proxy는 iterator를 움직이거나 파괴하기 전까지만 씁니다.
+        class iterator
+        {
+        private:
+            soa_vector *owner;
+            size_type index;
+            mutable typename std::aligned_storage<sizeof(soa_vector::reference), alignof(soa_vector::reference)>::type stash;
+
+        public:
+            using Self = iterator;
+            friend const_iterator;
+
+        public:
+            using value_type = soa_vector::value_type;
+            using reference = soa_vector::reference &;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+
+        public:
+            iterator() : owner(nullptr), index(0)
+            {
+            }
+            iterator(soa_vector *o, size_type i) : owner(o), index(i)
+            {
+            }
+            //stash는 복사하지 않습니다. 역참조할 때 다시 만듭니다.
+            iterator(const Self &other) : owner(other.owner), index(other.index)
+            {
+            }
+            Self &operator=(const Self &other)
+            {
+                owner = other.owner;
+                index = other.index;
+                return *this;
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                index++;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                index++;
+                return temp;
+            }
+            Self &operator--()
+            {
+                index--;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                index--;
+                return temp;
+            }
+            Self &operator+=(difference_type n)
+            {
+                index += n;
+                return *this;
+            }
+            Self &operator-=(difference_type n)
+            {
+                index -= n;
+                return *this;
+            }
+            Self operator+(difference_type n) const
+            {
+                return Self(owner, index + n);
+            }
+            friend Self operator+(difference_type n, const Self &it)
+            {
+                return it + n;
+            }
+            Self operator-(difference_type n) const
+            {
+                return Self(owner, index - n);
+            }
+            difference_type operator-(const Self &other) const
+            {
+                return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+            }
+
+        public: //access operator
+            //proxy는 column 주소를 모은 것뿐이라 매번 새로 만드는 비용이 index를 비교하는 것과 같습니다.
+            reference operator*() const
+            {
+                ::new (static_cast<void *>(&stash)) soa_vector::reference((*owner)[index]);
+                return *reinterpret_cast<soa_vector::reference *>(&stash);
+            }
+            //임시 iterator에 proxy를 둘 수 없으므로 값으로 돌려줍니다. const proxy라서 옮겨지지 않습니다.
+            const soa_vector::reference operator[](difference_type n) const
+            {
+                return (*owner)[index + n];
+            }
+            size_type position() const noexcept
+            {
+                return index;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->index == other.index;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->index != other.index;
+            }
+            bool operator<(const Self &other) const
+            {
+                return this->index < other.index;
+            }
+            bool operator>(const Self &other) const
+            {
+                return this->index > other.index;
+            }
+            bool operator<=(const Self &other) const
+            {
+                return this->index <= other.index;
+            }
+            bool operator>=(const Self &other) const
+            {
+                return this->index >= other.index;
+            }
+        };
+
+        class const_iterator
+        {
+        private:
+            const soa_vector *owner;
+            size_type index;
+
+        public:
+            using Self = const_iterator;
+
+        public:
+            using value_type = soa_vector::value_type;
+            using reference = soa_vector::const_reference;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+
+        public:
+            const_iterator() : owner(nullptr), index(0)
+            {
+            }
+            const_iterator(const soa_vector *o, size_type i) : owner(o), index(i)
+            {
+            }
+            const_iterator(const iterator &mutable_iterator) : owner(mutable_iterator.owner), index(mutable_iterator.index)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                index++;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                index++;
+                return temp;
+            }
+            Self &operator--()
+            {
+                index--;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                index--;
+                return temp;
+            }
+            Self &operator+=(difference_type n)
+            {
+                index += n;
+                return *this;
+            }
+            Self &operator-=(difference_type n)
+            {
+                index -= n;
+                return *this;
+            }
+            Self operator+(difference_type n) const
+            {
+                return Self(owner, index + n);
+            }
+            friend Self operator+(difference_type n, const Self &it)
+            {
+                return it + n;
+            }
+            Self operator-(difference_type n) const
+            {
+                return Self(owner, index - n);
+            }
+            difference_type operator-(const Self &other) const
+            {
+                return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                return (*owner)[index];
+            }
+            reference operator[](difference_type n) const
+            {
+                return (*owner)[index + n];
+            }
+            size_type position() const noexcept
+            {
+                return index;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->index == other.index;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->index != other.index;
+            }
+            bool operator<(const Self &other) const
+            {
+                return this->index < other.index;
+            }
+            bool operator>(const Self &other) const
+            {
+                return this->index > other.index;
+            }
+            bool operator<=(const Self &other) const
+            {
+                return this->index <= other.index;
+            }
+            bool operator>=(const Self &other) const
+            {
+                return this->index >= other.index;
+            }
+        };
+    };
+} // namespace xstl
+
+#endif
@@ -0,0 +1,274 @@
+#ifndef __XSTL_STATIC_SORTED_MAP__
+#define __XSTL_STATIC_SORTED_MAP__
+
+/*
+    Compile-time Sorted Set / Map.
+    Built from a braced list of N entries, sorted once in the constructor, then searched by a branchless binary search.
+    From C++14 the constructor and every lookup are constexpr, so a table declared constexpr is sorted
+    by the compiler and a lookup with a constant key folds to a constant. In C++11 the same code runs at runtime.
+    Duplicate keys throw invalid_argument (a compile error when built in a constant expression).
+*/
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+//C++14부터 constexpr 함수 안에 반복문과 대입을 쓸 수 있습니다.
+#ifndef __XSTL_CONSTEXPR14
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define __XSTL_CONSTEXPR14 constexpr
+#else
+#define __XSTL_CONSTEXPR14
+#endif
+#endif
+
+namespace xstl
+{
+    //정렬된 keys[0, N)에서 key보다 작지 않은 첫 위치입니다. 비교 결과로 더할 양만 고르므로 분기가 없습니다.
+    template <class T, class Compare>
+    __XSTL_CONSTEXPR14 std::size_t _static_lower_bound(const T *keys, std::size_t length, const T &key, const Compare &compare)
+    {
+        if (length == 0)
+            return 0;
+        std::size_t base = 0;
+        while (length > 1)
+        {
+            std::size_t half = length / 2;
+            base += compare(keys[base + half - 1], key) ? half : 0;
+            length -= half;
+        }
+        return base + (compare(keys[base], key) ? 1 : 0);
+    }
+
+    template <class T, std::size_t N, class Compare = std::less<T>>
+    class static_sorted_set
+    {
+    public:
+        using Self = static_sorted_set;
+
+    public: //stl standard type member
+        using value_type = T;
+        using key_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using key_compare = Compare;
+        using const_reference = const value_type &;
+        using const_pointer = const value_type *;
+        using iterator = const_pointer;
+        using const_iterator = const_pointer;
+
+    private:
+        T _keys[N == 0 ? 1 : N];
+        Compare _compare;
+
+    public:
+        __XSTL_CONSTEXPR14 explicit static_sorted_set(const T (&values)[N], const Compare &compare = Compare()) : _keys{}, _compare(compare)
+        {
+            //N이 작은 표를 위한 것이므로 삽입 정렬로 충분합니다.
+            for (size_type i = 0; i < N; i++)
+            {
+                T value = values[i];
+                size_type j = i;
+                for (; j > 0 && this->_compare(value, this->_keys[j - 1]); j--)
+                    this->_keys[j] = this->_keys[j - 1];
+                this->_keys[j] = value;
+            }
+            for (size_type i = 1; i < N; i++)
+                if (!this->_compare(this->_keys[i - 1], this->_keys[i]))
+                    throw std::invalid_argument("static_sorted_set: duplicate key");
+        }
+
+    public: //capacity
+        constexpr bool empty() const noexcept
+        {
+            return N == 0;
+        }
+        constexpr size_type size() const noexcept
+        {
+            return N;
+        }
+
+    public: //element access
+        constexpr const_reference operator[](size_type index) const
+        {
+            return this->_keys[index];
+        }
+        constexpr const_pointer data() const noexcept
+        {
+            return this->_keys;
+        }
+
+    public: //lookup
+        __XSTL_CONSTEXPR14 const_iterator lower_bound(const key_type &key) const
+        {
+            return this->_keys + _static_lower_bound(this->_keys, N, key, this->_compare);
+        }
+        __XSTL_CONSTEXPR14 const_iterator upper_bound(const key_type &key) const
+        {
+            const_iterator found = this->lower_bound(key);
+            return found != this->end() && !this->_compare(key, *found) ? found + 1 : found;
+        }
+        __XSTL_CONSTEXPR14 const_iterator find(const key_type &key) const
+        {
+            const_iterator found = this->lower_bound(key);
+            return found != this->end() && !this->_compare(key, *found) ? found : this->end();
+        }
+        //key의 정렬 순위입니다. 없으면 size()입니다.
+        __XSTL_CONSTEXPR14 size_type index_of(const key_type &key) const
+        {
+            return static_cast<size_type>(this->find(key) - this->_keys);
+        }
+        __XSTL_CONSTEXPR14 bool contains(const key_type &key) const
+        {
+            return this->find(key) != this->end();
+        }
+        __XSTL_CONSTEXPR14 size_type count(const key_type &key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+    public: //iterator
+        constexpr const_iterator begin() const noexcept
+        {
+            return this->_keys;
+        }
+        constexpr const_iterator end() const noexcept
+        {
+            return this->_keys + N;
+        }
+        constexpr const_iterator cbegin() const noexcept
+        {
+            return this->_keys;
+        }
+        constexpr const_iterator cend() const noexcept
+        {
+            return this->_keys + N;
+        }
+    };
+
+    //key와 value를 따로 두어 검색은 key 배열만 훑습니다.
+    template <class K, class V, std::size_t N, class Compare = std::less<K>>
+    class static_sorted_map
+    {
+    public:
+        using Self = static_sorted_map;
+
+    public: //stl standard type member
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using key_compare = Compare;
+
+    private:
+        K _keys[N == 0 ? 1 : N];
+        V _values[N == 0 ? 1 : N];
+        Compare _compare;
+
+    public:
+        __XSTL_CONSTEXPR14 explicit static_sorted_map(const std::pair<K, V> (&entries)[N], const Compare &compare = Compare()) : _keys{}, _values{}, _compare(compare)
+        {
+            for (size_type i = 0; i < N; i++)
+            {
+                K key = entries[i].first;
+                size_type j = i;
+                for (; j > 0 && this->_compare(key, this->_keys[j - 1]); j--)
+                {
+                    this->_keys[j] = this->_keys[j - 1];
+                    this->_values[j] = this->_values[j - 1];
+                }
+                this->_keys[j] = key;
+                this->_values[j] = entries[i].second;
+            }
+            for (size_type i = 1; i < N; i++)
+                if (!this->_compare(this->_keys[i - 1], this->_keys[i]))
+                    throw std::invalid_argument("static_sorted_map: duplicate key");
+        }
+
+    public: //capacity
+        constexpr bool empty() const noexcept
+        {
+            return N == 0;
+        }
+        constexpr size_type size() const noexcept
+        {
+            return N;
+        }
+
+    public: //element access
+        //정렬 순위 index의 key와 value입니다.
+        constexpr const key_type &key_at(size_type index) const
+        {
+            return this->_keys[index];
+        }
+        constexpr const mapped_type &value_at(size_type index) const
+        {
+            return this->_values[index];
+        }
+        __XSTL_CONSTEXPR14 const mapped_type &at(const key_type &key) const
+        {
+            size_type index = this->index_of(key);
+            if (index == N)
+                throw std::out_of_range("static_sorted_map::at");
+            return this->_values[index];
+        }
+        //없으면 fallback을 돌려줍니다.
+        __XSTL_CONSTEXPR14 mapped_type value_or(const key_type &key, const mapped_type &fallback) const
+        {
+            size_type index = this->index_of(key);
+            return index == N ? fallback : this->_values[index];
+        }
+
+    public: //lookup
+        //key의 정렬 순위입니다. 없으면 size()입니다.
+        __XSTL_CONSTEXPR14 size_type index_of(const key_type &key) const
+        {
+            size_type index = _static_lower_bound(this->_keys, N, key, this->_compare);
+            return index != N && !this->_compare(key, this->_keys[index]) ? index : N;
+        }
+        //없으면 nullptr입니다.
+        __XSTL_CONSTEXPR14 const mapped_type *find(const key_type &key) const
+        {
+            size_type index = this->index_of(key);
+            return index == N ? nullptr : this->_values + index;
+        }
+        __XSTL_CONSTEXPR14 bool contains(const key_type &key) const
+        {
+            return this->index_of(key) != N;
+        }
+        __XSTL_CONSTEXPR14 size_type count(const key_type &key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+        __XSTL_CONSTEXPR14 size_type lower_bound(const key_type &key) const
+        {
+            return _static_lower_bound(this->_keys, N, key, this->_compare);
+        }
+
+        constexpr const key_type *keys() const noexcept
+        {
+            return this->_keys;
+        }
+        constexpr const mapped_type *values() const noexcept
+        {
+            return this->_values;
+        }
+    };
+
+    //N을 braced list에서 추론합니다. constexpr auto table = make_static_sorted_set<int>({3, 1, 2});
+    template <class T, class Compare = std::less<T>, std::size_t N>
+    __XSTL_CONSTEXPR14 static_sorted_set<T, N, Compare> make_static_sorted_set(const T (&values)[N], const Compare &compare = Compare())
+    {
+        return static_sorted_set<T, N, Compare>(values, compare);
+    }
+
+    //constexpr auto opcodes = make_static_sorted_map<int, const char *>({{0x90, "nop"}, {0xc3, "ret"}});
+    template <class K, class V, class Compare = std::less<K>, std::size_t N>
+    __XSTL_CONSTEXPR14 static_sorted_map<K, V, N, Compare> make_static_sorted_map(const std::pair<K, V> (&entries)[N], const Compare &compare = Compare())
+    {
+        return static_sorted_map<K, V, N, Compare>(entries, compare);
+    }
+} // namespace xstl
+
+#endif
@@ -0,0 +1,408 @@
+#ifndef __XSTL_STATIC_VECTOR__
+#define __XSTL_STATIC_VECTOR__
+
+/*
+    Compile-time Capacity Vector.
+    Holds up to N elements inside the object itself and never touches the heap.
+    The length changes at runtime like std::vector, but going past N throws length_error.
+*/
+
+#include <stdexcept>
+#include <utility>
+#include <iterator>
+#include <algorithm> //move, rotate, equal
+#include <new>
+#include <type_traits>
+#include <initializer_list>
+
+namespace xstl
+{
+    template <class T, std::size_t N>
+    class static_vector
+    {
+    public:
+        using Self = static_vector;
+
+    public: //stl standard type member
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type static_capacity = N;
+
+    private:
+        typename std::aligned_storage<sizeof(value_type) * (N == 0 ? 1 : N), alignof(value_type)>::type _storage;
+        size_type _length = 0;
+
+    private: //storage helper
+        pointer _data() noexcept
+        {
+            return reinterpret_cast<pointer>(&this->_storage);
+        }
+        const_pointer _data() const noexcept
+        {
+            return reinterpret_cast<const_pointer>(&this->_storage);
+        }
+
+        void _check_room(size_type length) const
+        {
+            if (length > N)
+                throw std::length_error("static_vector: capacity exceeded");
+        }
+        //뒤쪽 [length, _length)를 파괴합니다.
+        void _destroy_from(size_type length) noexcept
+        {
+            if (!std::is_trivially_destructible<value_type>::value)
+                for (size_type i = length; i < this->_length; i++)
+                    this->_data()[i].~value_type();
+            this->_length = length;
+        }
+
+        //하나씩 만들고 길이를 늘리므로 도중에 예외가 나도 만든 것까지만 남습니다.
+        template <class InputIterator>
+        void _append(InputIterator begin, InputIterator end)
+        {
+            for (; begin != end; ++begin)
+                this->emplace_back(*begin);
+        }
+        //생성자에서 실패하면 소멸자가 불리지 않으므로 만든 요소를 직접 파괴합니다.
+        template <class InputIterator>
+        void _construct(InputIterator begin, InputIterator end)
+        {
+            try
+            {
+                this->_append(begin, end);
+            }
+            catch (...)
+            {
+                this->_destroy_from(0);
+                throw;
+            }
+        }
+
+    public:
+        static_vector() noexcept = default;
+        ~static_vector()
+        {
+            this->_destroy_from(0);
+        }
+
+        explicit static_vector(size_type length)
+        {
+            this->_check_room(length);
+            try
+            {
+                this->resize(length);
+            }
+            catch (...)
+            {
+                this->_destroy_from(0);
+                throw;
+            }
+        }
+        static_vector(size_type length, const_reference value)
+        {
+            this->_check_room(length);
+            try
+            {
+                this->resize(length, value);
+            }
+            catch (...)
+            {
+                this->_destroy_from(0);
+                throw;
+            }
+        }
+        static_vector(std::initializer_list<value_type> init)
+        {
+            this->_check_room(init.size());
+            this->_construct(init.begin(), init.end());
+        }
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        static_vector(InputIterator begin, InputIterator end)
+        {
+            this->_construct(begin, end);
+        }
+
+    public: //copy & move
+        static_vector(const Self &other)
+        {
+            this->_construct(other.begin(), other.end());
+        }
+        //요소가 object 안에 있으므로 포인터를 가져올 수 없고 하나씩 옮깁니다.
+        static_vector(Self &&other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
+        {
+            this->_construct(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+        Self &operator=(const Self &other)
+        {
+            if (this != &other)
+                this->assign(other.begin(), other.end());
+            return *this;
+        }
+        Self &operator=(Self &&other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
+        {
+            if (this != &other)
+            {
+                this->_destroy_from(0);
+                this->_append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            }
+            return *this;
+        }
+
+    public: //element access
+        reference operator[](size_type index)
+        {
+            return this->_data()[index];
+        }
+        const_reference operator[](size_type index) const
+        {
+            return this->_data()[index];
+        }
+        reference at(size_type index)
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("static_vector::at");
+            return this->_data()[index];
+        }
+        const_reference at(size_type index) const
+        {
+            if (index >= this->_length)
+                throw std::out_of_range("static_vector::at");
+            return this->_data()[index];
+        }
+        reference front()
+        {
+            return this->_data()[0];
+        }
+        const_reference front() const
+        {
+            return this->_data()[0];
+        }
+        reference back()
+        {
+            return this->_data()[this->_length - 1];
+        }
+        const_reference back() const
+        {
+            return this->_data()[this->_length - 1];
+        }
+        pointer data() noexcept
+        {
+            return this->_data();
+        }
+        const_pointer data() const noexcept
+        {
+            return this->_data();
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        bool full() const noexcept
+        {
+            return this->_length == N;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+        static constexpr size_type capacity() noexcept
+        {
+            return N;
+        }
+        static constexpr size_type max_size() noexcept
+        {
+            return N;
+        }
+
+    public: //modifiers
+        template <class... Args>
+        reference emplace_back(Args &&... args)
+        {
+            this->_check_room(this->_length + 1);
+            pointer slot = this->_data() + this->_length;
+            ::new (static_cast<void *>(slot)) value_type(std::forward<Args>(args)...);
+            this->_length++;
+            return *slot;
+        }
+        void push_back(const_reference value)
+        {
+            this->emplace_back(value);
+        }
+        void push_back(value_type &&value)
+        {
+            this->emplace_back(std::move(value));
+        }
+        void pop_back() noexcept
+        {
+            this->_destroy_from(this->_length - 1);
+        }
+
+        //뒤에 만든 뒤 제자리로 돌려 넣습니다.
+        template <class... Args>
+        iterator emplace(const_iterator position, Args &&... args)
+        {
+            size_type index = static_cast<size_type>(position - this->cbegin());
+            this->emplace_back(std::forward<Args>(args)...);
+            std::rotate(this->begin() + index, this->end() - 1, this->end());
+            return this->begin() + index;
+        }
+        iterator insert(const_iterator position, const_reference value)
+        {
+            return this->emplace(position, value);
+        }
+        iterator insert(const_iterator position, value_type &&value)
+        {
+            return this->emplace(position, std::move(value));
+        }
+
+        iterator erase(const_iterator position)
+        {
+            return this->erase(position, position + 1);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            iterator begin = this->begin() + (first - this->cbegin());
+            iterator end = this->begin() + (last - this->cbegin());
+            iterator kept = std::move(end, this->end(), begin);
+            this->_destroy_from(static_cast<size_type>(kept - this->begin()));
+            return begin;
+        }
+
+        void resize(size_type length)
+        {
+            this->_check_room(length);
+            if (length < this->_length)
+                return this->_destroy_from(length);
+            while (this->_length < length)
+                this->emplace_back();
+        }
+        void resize(size_type length, const_reference value)
+        {
+            this->_check_room(length);
+            if (length < this->_length)
+                return this->_destroy_from(length);
+            while (this->_length < length)
+                this->emplace_back(value);
+        }
+
+        void assign(size_type length, const_reference value)
+        {
+            this->_check_room(length);
+            //value가 자기 요소일 수 있으므로 먼저 복사해 둡니다.
+            value_type copied = value;
+            this->_destroy_from(0);
+            this->resize(length, copied);
+        }
+        void assign(std::initializer_list<value_type> init)
+        {
+            this->_check_room(init.size());
+            this->_destroy_from(0);
+            this->_append(init.begin(), init.end());
+        }
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        void assign(InputIterator begin, InputIterator end)
+        {
+            this->_destroy_from(0);
+            this->_append(begin, end);
+        }
+
+        void clear() noexcept
+        {
+            this->_destroy_from(0);
+        }
+
+        void swap(Self &other)
+        {
+            Self &longer = this->_length < other._length ? other : *this;
+            Self &shorter = this->_length < other._length ? *this : other;
+            size_type common = shorter._length;
+            for (size_type i = 0; i < common; i++)
+            {
+                using std::swap;
+                swap(longer[i], shorter[i]);
+            }
+            for (size_type i = common; i < longer._length; i++)
+                shorter.emplace_back(std::move(longer[i]));
+            longer._destroy_from(common);
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            return this->_data();
+        }
+        const_iterator begin() const noexcept
+        {
+            return this->_data();
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return this->_data();
+        }
+        iterator end() noexcept
+        {
+            return this->_data() + this->_length;
+        }
+        const_iterator end() const noexcept
+        {
+            return this->_data() + this->_length;
+        }
+        const_iterator cend() const noexcept
+        {
+            return this->_data() + this->_length;
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return this->crbegin();
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(this->cend());
+        }
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rend() const noexcept
+        {
+            return this->crend();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(this->cbegin());
+        }
+
+    public: //comparer
+        bool operator==(const Self &other) const
+        {
+            return this->_length == other._length && std::equal(this->begin(), this->end(), other.begin());
+        }
+        bool operator!=(const Self &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    template <class T, std::size_t N>
+    constexpr typename static_vector<T, N>::size_type static_vector<T, N>::static_capacity;
+} // namespace xstl
+
+#endif
@@ -0,0 +1,161 @@
+/*
+    art_map against std::map.
+    splay_map does not compile in this tree and btree.h is still empty, so std::map (red-black tree)
+    stands in as the comparison based ordered map.
+    Keys are URL paths and 64 bit IDs whose upper bytes are shared (tenant id in the top 16 bits).
+    The prefix scan on std::map is lower_bound(prefix) and walking until a key no longer starts with it.
+    usage: art_map [keys]
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "../tree/art_map.h"
+#include "./bench.h"
+
+namespace
+{
+    bool starts_with(const std::string &key, const std::string &prefix)
+    {
+        return key.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    //std::map의 prefix scan입니다. 지나간 요소 수를 돌려줍니다.
+    std::size_t scan(const std::map<std::string, std::uint64_t> &map, const std::string &prefix, std::uint64_t &sum)
+    {
+        std::size_t visited = 0;
+        for (auto it = map.lower_bound(prefix); it != map.end() && starts_with(it->first, prefix); ++it, visited++)
+            sum += it->second;
+        return visited;
+    }
+    std::size_t scan(const xstl::art_map<std::string, std::uint64_t> &map, const std::string &prefix, std::uint64_t &sum)
+    {
+        std::size_t visited = 0;
+        for (const auto &element : map.prefix_range(prefix))
+            sum += element.second, visited++;
+        return visited;
+    }
+    //정수 key는 상위 2 byte(tenant)가 같은 요소들을 훑습니다.
+    std::size_t scan(const std::map<std::uint64_t, std::uint64_t> &map, std::uint64_t tenant, std::uint64_t &sum)
+    {
+        std::size_t visited = 0;
+        for (auto it = map.lower_bound(tenant << 48); it != map.end() && (it->first >> 48) == tenant; ++it, visited++)
+            sum += it->second;
+        return visited;
+    }
+    std::size_t scan(const xstl::art_map<std::uint64_t, std::uint64_t> &map, std::uint64_t tenant, std::uint64_t &sum)
+    {
+        std::size_t visited = 0;
+        for (const auto &element : map.prefix_range(tenant << 48, 2))
+            sum += element.second, visited++;
+        return visited;
+    }
+
+    template <class Map, class Key, class Prefix>
+    void run(const char *name, const std::vector<Key> &keys, const std::vector<Key> &probes, const std::vector<Prefix> &prefixes)
+    {
+        double count = static_cast<double>(keys.size());
+        char label[96];
+        Map map;
+
+        std::snprintf(label, sizeof(label), "%s insert", name);
+        bench::report(label, bench::seconds([&] {
+                          std::uint64_t value = 0;
+                          for (const Key &key : keys)
+                              map.emplace(key, value++);
+                      }),
+                      count);
+
+        std::uint64_t sum = 0;
+        std::snprintf(label, sizeof(label), "%s find", name);
+        bench::report(label, bench::best_of(3, [&] {
+                          for (const Key &key : probes)
+                          {
+                              auto found = map.find(key);
+                              sum += found != map.end() ? found->second : 1;
+                          }
+                      }),
+                      static_cast<double>(probes.size()));
+
+        std::snprintf(label, sizeof(label), "%s ordered iteration", name);
+        bench::report(label, bench::best_of(3, [&] {
+                          for (const auto &element : map)
+                              sum += element.second;
+                      }),
+                      static_cast<double>(map.size()));
+
+        std::size_t visited = 0;
+        double elapsed = bench::best_of(3, [&] {
+            visited = 0;
+            for (const Prefix &prefix : prefixes)
+                visited += scan(map, prefix, sum);
+        });
+        std::snprintf(label, sizeof(label), "%s prefix scan (%zu hits)", name, visited);
+        bench::report(label, elapsed, static_cast<double>(visited));
+        bench::keep(sum);
+    }
+
+    //"/api/v<1-3>/<resource>/<id>/<sub>" 모양의 경로입니다. 앞부분이 길게 겹칩니다.
+    std::string url_path(std::mt19937_64 &random)
+    {
+        static const char *const resources[] = {"users", "orders", "products", "invoices", "sessions", "reports", "teams", "projects"};
+        static const char *const subresources[] = {"", "/items", "/history", "/settings", "/members", "/attachments"};
+        std::string path = "/api/v";
+        path += static_cast<char>('1' + random() % 3);
+        path += '/';
+        path += resources[random() % 8];
+        path += '/';
+        path += std::to_string(random() % 1000000);
+        path += subresources[random() % 6];
+        return path;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::atoll(argv[1])) : (std::size_t(1) << 20);
+    std::printf("%zu keys\n", count);
+    std::mt19937_64 random(3);
+
+    {
+        std::vector<std::string> keys(count);
+        for (auto &key : keys)
+            key = url_path(random);
+        //찾기는 절반이 있는 key, 절반이 새로 만든 key입니다.
+        std::vector<std::string> probes(count);
+        for (std::size_t i = 0; i < count; i++)
+            probes[i] = i % 2 == 0 ? keys[random() % count] : url_path(random);
+        //"/api/v2/orders/12" 처럼 id 앞자리까지 준 prefix입니다.
+        std::vector<std::string> prefixes(1000);
+        for (auto &prefix : prefixes)
+        {
+            prefix = keys[random() % count];
+            prefix.resize(std::min(prefix.size(), prefix.find('/', 8) + 3));
+        }
+
+        bench::title("URL paths");
+        run<std::map<std::string, std::uint64_t>>("std::map", keys, probes, prefixes);
+        run<xstl::art_map<std::string, std::uint64_t>>("xstl::art_map", keys, probes, prefixes);
+    }
+    {
+        //상위 16 bit는 tenant 64개 중 하나, 나머지는 임의 값입니다.
+        std::vector<std::uint64_t> keys(count), probes(count);
+        for (auto &key : keys)
+            key = (random() % 64) << 48 | (random() & 0xFFFFFFFFFFFFull);
+        for (std::size_t i = 0; i < count; i++)
+            probes[i] = i % 2 == 0 ? keys[random() % count] : (random() % 64) << 48 | (random() & 0xFFFFFFFFFFFFull);
+        std::vector<std::uint64_t> tenants(64);
+        for (std::size_t i = 0; i < tenants.size(); i++)
+            tenants[i] = i;
+
+        bench::title("64 bit IDs, 64 tenants in the top 16 bits");
+        run<std::map<std::uint64_t, std::uint64_t>>("std::map", keys, probes, tenants);
+        run<xstl::art_map<std::uint64_t, std::uint64_t>>("xstl::art_map", keys, probes, tenants);
+    }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+#ifndef __XSTL_BENCH__
+#define __XSTL_BENCH__
+
+/*
+    Timing helpers shared by the benchmark programs in this directory.
+    Every benchmark is a standalone main, built like test.cpp:
+        g++ -std=c++11 -O2 -pthread bench/<name>.cpp -o <name>
+    Numbers are wall clock and depend on the machine; compare rows of one run, not runs of different machines.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+
+namespace bench
+{
+    //function 한 번의 실행 시간(초)입니다.
+    template <class Function>
+    double seconds(Function function)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - begin).count();
+    }
+
+    //runs번 돌려 가장 빠른 시간을 씁니다. 처음 실행의 page fault나 cache 예열을 빼기 위함입니다.
+    template <class Function>
+    double best_of(int runs, Function function)
+    {
+        double best = seconds(function);
+        for (int i = 1; i < runs; i++)
+        {
+            double elapsed = seconds(function);
+            if (elapsed < best)
+                best = elapsed;
+        }
+        return best;
+    }
+
+    //compiler가 결과를 쓰지 않는다고 보고 계산을 지우지 못하게 합니다.
+    template <class T>
+    inline void keep(const T &value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static const void *volatile sink;
+        sink = &value;
+#endif
+    }
+
+    inline void title(const char *text)
+    {
+        std::printf("\n== %s\n", text);
+    }
+    //operations를 seconds 동안 했을 때의 한 줄 결과입니다. operations가 0이면 시간만 씁니다.
+    inline void report(const char *name, double seconds, double operations = 0)
+    {
+        if (operations > 0)
+            std::printf("  %-44s %10.2f ms %10.2f Mops/s\n", name, seconds * 1e3, operations / seconds / 1e6);
+        else
+            std::printf("  %-44s %10.2f ms\n", name, seconds * 1e3);
+    }
+} // namespace bench
+
+#endif
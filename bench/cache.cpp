@@ -0,0 +1,195 @@
+/*
+    lru_cache and arc_cache against the usual hand-rolled LRU: std::list of entries plus
+    std::unordered_map of list iterators (two allocations per entry).
+    Every access is get, then put on a miss. The traces are Zipf distributed keys, with and without
+    one-shot sequential scans mixed in (where ARC keeps its frequent set and LRU does not).
+    The last section runs the same trace from several threads through sharded_cache and through one mutex.
+    usage: cache [accesses] [threads]
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../cache/arc_cache.h"
+#include "../cache/lru_cache.h"
+#include "../cache/sharded_cache.h"
+#include "./bench.h"
+
+namespace
+{
+    const std::size_t key_count = 1 << 20;
+    const std::size_t capacity = 1 << 16;
+
+    class list_map_lru
+    {
+    private:
+        using entry = std::pair<std::uint64_t, std::uint64_t>;
+        std::list<entry> _recency;
+        std::unordered_map<std::uint64_t, std::list<entry>::iterator> _index;
+        std::size_t _capacity;
+        xstl::cache_stats _stats;
+
+    public:
+        explicit list_map_lru(std::size_t c) : _capacity(c)
+        {
+        }
+        std::uint64_t *get(std::uint64_t key)
+        {
+            auto found = this->_index.find(key);
+            if (found == this->_index.end())
+            {
+                this->_stats.misses++;
+                return nullptr;
+            }
+            this->_stats.hits++;
+            this->_recency.splice(this->_recency.begin(), this->_recency, found->second);
+            return &found->second->second;
+        }
+        void put(std::uint64_t key, std::uint64_t value)
+        {
+            this->_recency.emplace_front(key, value);
+            this->_index[key] = this->_recency.begin();
+            if (this->_recency.size() > this->_capacity)
+            {
+                this->_index.erase(this->_recency.back().first);
+                this->_recency.pop_back();
+            }
+        }
+        const xstl::cache_stats &stats() const
+        {
+            return this->_stats;
+        }
+    };
+
+    //skew 1.0 근처의 Zipf 분포에서 count개 key를 뽑습니다. 자주 쓰는 key가 작은 번호에 몰리지 않게 섞습니다.
+    std::vector<std::uint64_t> zipf_trace(std::size_t count, double skew, std::uint64_t seed)
+    {
+        std::vector<double> cumulative(key_count);
+        double total = 0;
+        for (std::size_t i = 0; i < key_count; i++)
+        {
+            total += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+            cumulative[i] = total;
+        }
+
+        std::vector<std::uint64_t> permutation(key_count);
+        for (std::size_t i = 0; i < key_count; i++)
+            permutation[i] = i;
+        std::mt19937_64 random(seed);
+        std::shuffle(permutation.begin(), permutation.end(), random);
+
+        std::uniform_real_distribution<double> uniform(0, total);
+        std::vector<std::uint64_t> trace(count);
+        for (auto &key : trace)
+            key = permutation[std::lower_bound(cumulative.begin(), cumulative.end(), uniform(random)) - cumulative.begin()];
+        return trace;
+    }
+
+    //every번째 접근마다 한 번만 쓰이는 key를 length개 연속으로 끼워 넣습니다.
+    std::vector<std::uint64_t> with_scans(const std::vector<std::uint64_t> &trace, std::size_t every, std::size_t length)
+    {
+        std::vector<std::uint64_t> mixed;
+        std::uint64_t next_scan_key = key_count;
+        for (std::size_t i = 0; i < trace.size(); i++)
+        {
+            mixed.push_back(trace[i]);
+            if (i % every == every - 1)
+                for (std::size_t j = 0; j < length; j++)
+                    mixed.push_back(next_scan_key++);
+        }
+        return mixed;
+    }
+
+    template <class Cache>
+    void replay(const char *name, Cache &cache, const std::vector<std::uint64_t> &trace)
+    {
+        double elapsed = bench::seconds([&] {
+            for (std::uint64_t key : trace)
+                if (cache.get(key) == nullptr)
+                    cache.put(key, key);
+        });
+        char label[96];
+        std::snprintf(label, sizeof(label), "%s (hit %.1f%%)", name, cache.stats().hit_ratio() * 100);
+        bench::report(label, elapsed, static_cast<double>(trace.size()));
+    }
+
+    void run_single(const char *title, const std::vector<std::uint64_t> &trace)
+    {
+        bench::title(title);
+        {
+            list_map_lru cache(capacity);
+            replay("std::list + std::unordered_map", cache, trace);
+        }
+        {
+            xstl::lru_cache<std::uint64_t, std::uint64_t> cache(capacity);
+            replay("xstl::lru_cache", cache, trace);
+        }
+        {
+            xstl::arc_cache<std::uint64_t, std::uint64_t> cache(capacity);
+            replay("xstl::arc_cache", cache, trace);
+        }
+    }
+
+    //thread마다 trace의 다른 구간을 돌립니다.
+    template <class Access>
+    double run_threads(unsigned threads, const std::vector<std::uint64_t> &trace, Access access)
+    {
+        std::vector<std::thread> workers;
+        return bench::seconds([&] {
+            for (unsigned t = 0; t < threads; t++)
+                workers.emplace_back([&, t] {
+                    std::size_t begin = trace.size() / threads * t;
+                    std::size_t end = begin + trace.size() / threads;
+                    for (std::size_t i = begin; i < end; i++)
+                        access(trace[i]);
+                });
+            for (auto &worker : workers)
+                worker.join();
+        });
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t accesses = argc > 1 ? static_cast<std::size_t>(std::atoll(argv[1])) : (std::size_t(1) << 22);
+    unsigned threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : std::thread::hardware_concurrency();
+    if (threads == 0)
+        threads = 4;
+    std::printf("%zu accesses over %zu keys, capacity %zu entries\n", accesses, key_count, capacity);
+
+    std::vector<std::uint64_t> trace = zipf_trace(accesses, 0.99, 1);
+    run_single("zipf 0.99", trace);
+    run_single("zipf 0.99 + one-shot scans", with_scans(trace, 1000, 500));
+
+    {
+        char title[64];
+        std::snprintf(title, sizeof(title), "zipf 0.99, %u threads", threads);
+        bench::title(title);
+
+        xstl::sharded_cache<xstl::lru_cache<std::uint64_t, std::uint64_t>> sharded(capacity, 64);
+        bench::report("sharded_cache<lru_cache>, 64 shards", run_threads(threads, trace, [&](std::uint64_t key) {
+                          std::uint64_t value;
+                          if (!sharded.get(key, value))
+                              sharded.put(key, key);
+                      }),
+                      static_cast<double>(trace.size()));
+
+        std::mutex lock;
+        xstl::lru_cache<std::uint64_t, std::uint64_t> single(capacity);
+        bench::report("lru_cache + std::mutex", run_threads(threads, trace, [&](std::uint64_t key) {
+                          std::lock_guard<std::mutex> guard(lock);
+                          if (single.get(key) == nullptr)
+                              single.put(key, key);
+                      }),
+                      static_cast<double>(trace.size()));
+    }
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+    concurrent_hash_map against a std::unordered_map behind one global mutex.
+    Every thread runs the same mix of lookups and writes (half insert_or_assign, half erase)
+    over a shared key range, at read/write ratios of 99/1, 90/10 and 50/50.
+    usage: concurrent_hash_map [threads] [operations per thread]
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../hash/concurrent_hash_map.h"
+#include "./bench.h"
+
+namespace
+{
+    const std::uint64_t key_range = 1 << 16;
+
+    struct locked_unordered_map
+    {
+        std::mutex lock;
+        std::unordered_map<std::uint64_t, std::uint64_t> map;
+
+        bool find(std::uint64_t key, std::uint64_t &value)
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            auto found = this->map.find(key);
+            if (found == this->map.end())
+                return false;
+            value = found->second;
+            return true;
+        }
+        void insert_or_assign(std::uint64_t key, std::uint64_t value)
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->map[key] = value;
+        }
+        void erase(std::uint64_t key)
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->map.erase(key);
+        }
+    };
+
+    //xorshift64*: thread마다 독립적이고 lock이 없는 난수입니다.
+    std::uint64_t next_random(std::uint64_t &state)
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+
+    template <class Map>
+    double run(Map &map, unsigned threads, unsigned write_percent, std::size_t operations)
+    {
+        for (std::uint64_t key = 0; key < key_range; key += 2)
+            map.insert_or_assign(key, key);
+
+        std::atomic<unsigned> ready{0};
+        std::atomic<bool> start{false};
+        std::vector<std::thread> workers;
+        std::uint64_t found_total = 0;
+        std::mutex found_lock;
+
+        for (unsigned t = 0; t < threads; t++)
+        {
+            workers.emplace_back([&, t] {
+                std::uint64_t state = 0x9E3779B97F4A7C15ull * (t + 1);
+                std::uint64_t found = 0, value = 0;
+                ready++;
+                while (!start.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+
+                for (std::size_t i = 0; i < operations; i++)
+                {
+                    std::uint64_t random = next_random(state);
+                    std::uint64_t key = (random >> 16) % key_range;
+                    if (random % 100 >= write_percent)
+                        found += map.find(key, value) ? 1 : 0;
+                    else if (random & (1 << 8))
+                        map.insert_or_assign(key, random);
+                    else
+                        map.erase(key);
+                }
+
+                std::lock_guard<std::mutex> guard(found_lock);
+                found_total += found + (value & 1);
+            });
+        }
+
+        while (ready.load() != threads)
+            std::this_thread::yield();
+        double elapsed = bench::seconds([&] {
+            start.store(true, std::memory_order_release);
+            for (auto &worker : workers)
+                worker.join();
+        });
+        bench::keep(found_total);
+        return elapsed;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    unsigned threads = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : std::thread::hardware_concurrency();
+    std::size_t operations = argc > 2 ? static_cast<std::size_t>(std::atoll(argv[2])) : 1000000;
+    if (threads == 0)
+        threads = 4;
+
+    std::printf("%u threads, %zu operations per thread, %llu keys\n", threads, operations, static_cast<unsigned long long>(key_range));
+
+    const unsigned write_percents[] = {1, 10, 50};
+    for (unsigned write_percent : write_percents)
+    {
+        char title[64];
+        std::snprintf(title, sizeof(title), "read/write %u/%u", 100 - write_percent, write_percent);
+        bench::title(title);
+
+        double total = static_cast<double>(threads) * static_cast<double>(operations);
+        {
+            xstl::concurrent_hash_map<std::uint64_t, std::uint64_t> map;
+            bench::report("xstl::concurrent_hash_map", run(map, threads, write_percent, operations), total);
+        }
+        {
+            locked_unordered_map map;
+            bench::report("std::unordered_map + std::mutex", run(map, threads, write_percent, operations), total);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+    integer_set against std::set<std::uint64_t>.
+    splay_tree<uint64_t> does not compile in this tree, so std::set stands in as the comparison based ordered set;
+    successor is upper_bound and predecessor is lower_bound then one step back.
+    Keys are dense IDs (n keys out of [0, 4n)) and sparse random 64 bit keys.
+    usage: integer_set [keys]
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+#include "../tree/integer_set.h"
+#include "./bench.h"
+
+namespace
+{
+    bool successor(const std::set<std::uint64_t> &set, std::uint64_t key, std::uint64_t &out)
+    {
+        auto found = set.upper_bound(key);
+        if (found == set.end())
+            return false;
+        out = *found;
+        return true;
+    }
+    bool successor(const xstl::integer_set<std::uint64_t> &set, std::uint64_t key, std::uint64_t &out)
+    {
+        return set.successor(key, out);
+    }
+    bool predecessor(const std::set<std::uint64_t> &set, std::uint64_t key, std::uint64_t &out)
+    {
+        auto found = set.lower_bound(key);
+        if (found == set.begin())
+            return false;
+        out = *--found;
+        return true;
+    }
+    bool predecessor(const xstl::integer_set<std::uint64_t> &set, std::uint64_t key, std::uint64_t &out)
+    {
+        return set.predecessor(key, out);
+    }
+
+    //keys를 넣고, probes로 찾고, keys를 모두 지우는 한 벌의 측정입니다.
+    template <class Set>
+    void run(const char *name, const std::vector<std::uint64_t> &keys, const std::vector<std::uint64_t> &probes)
+    {
+        double count = static_cast<double>(keys.size());
+        char label[96];
+        Set set;
+
+        std::snprintf(label, sizeof(label), "%s insert", name);
+        bench::report(label, bench::seconds([&] {
+                          for (std::uint64_t key : keys)
+                              set.insert(key);
+                      }),
+                      count);
+
+        std::uint64_t hits = 0, out = 0;
+        std::snprintf(label, sizeof(label), "%s contains", name);
+        bench::report(label, bench::best_of(3, [&] {
+                          for (std::uint64_t key : probes)
+                              hits += set.count(key);
+                      }),
+                      count);
+        std::snprintf(label, sizeof(label), "%s successor", name);
+        bench::report(label, bench::best_of(3, [&] {
+                          for (std::uint64_t key : probes)
+                              hits += successor(set, key, out) ? out & 1 : 0;
+                      }),
+                      count);
+        std::snprintf(label, sizeof(label), "%s predecessor", name);
+        bench::report(label, bench::best_of(3, [&] {
+                          for (std::uint64_t key : probes)
+                              hits += predecessor(set, key, out) ? out & 1 : 0;
+                      }),
+                      count);
+        bench::keep(hits);
+
+        std::snprintf(label, sizeof(label), "%s erase", name);
+        bench::report(label, bench::seconds([&] {
+                          for (std::uint64_t key : keys)
+                              set.erase(key);
+                      }),
+                      count);
+    }
+
+    void run_all(const char *title, const std::vector<std::uint64_t> &keys, const std::vector<std::uint64_t> &probes)
+    {
+        bench::title(title);
+        run<std::set<std::uint64_t>>("std::set", keys, probes);
+        run<xstl::integer_set<std::uint64_t>>("xstl::integer_set", keys, probes);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::atoll(argv[1])) : (std::size_t(1) << 20);
+    std::printf("%zu keys\n", count);
+    std::mt19937_64 random(11);
+
+    {
+        //[0, 4n)에서 n개를 뽑습니다. 찾기는 범위 전체의 임의 값이라 절반 넘게 없는 key입니다.
+        std::vector<std::uint64_t> keys(count * 4);
+        for (std::size_t i = 0; i < keys.size(); i++)
+            keys[i] = i;
+        std::shuffle(keys.begin(), keys.end(), random);
+        keys.resize(count);
+        std::vector<std::uint64_t> probes(count);
+        for (auto &probe : probes)
+            probe = random() % (count * 4);
+        run_all("dense IDs, n keys out of [0, 4n)", keys, probes);
+    }
+    {
+        std::vector<std::uint64_t> keys(count), probes(count);
+        for (auto &key : keys)
+            key = random();
+        for (auto &probe : probes)
+            probe = random();
+        run_all("random 64 bit keys", keys, probes);
+    }
+
+    return 0;
+}
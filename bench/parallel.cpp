@@ -0,0 +1,160 @@
+/*
+    thread_pool, fork_join and parallel_for against std::async.
+    std::async(std::launch::async) starts a thread per task, so the gap grows as tasks get smaller.
+    The xstl::par algorithms are compared with their sequential std counterparts.
+    usage: parallel [elements]
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <future>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../parallel/algorithm.h"
+#include "../parallel/fork_join.h"
+#include "./bench.h"
+
+namespace
+{
+    std::uint64_t work(std::uint64_t x)
+    {
+        for (int i = 0; i < 8; i++)
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+        return x;
+    }
+
+    //[0, length)를 grain 단위 chunk로 나눠 각각 work를 합산합니다.
+    std::uint64_t sum_with_parallel_for(std::size_t length, std::size_t grain)
+    {
+        std::atomic<std::uint64_t> total{0};
+        xstl::parallel_for(0, length, grain, [&](std::size_t begin, std::size_t end) {
+            std::uint64_t sum = 0;
+            for (std::size_t i = begin; i < end; i++)
+                sum += work(i);
+            total.fetch_add(sum, std::memory_order_relaxed);
+        });
+        return total.load();
+    }
+    std::uint64_t sum_with_async(std::size_t length, std::size_t grain)
+    {
+        std::vector<std::future<std::uint64_t>> futures;
+        for (std::size_t begin = 0; begin < length; begin += grain)
+        {
+            std::size_t end = std::min(length, begin + grain);
+            futures.push_back(std::async(std::launch::async, [begin, end] {
+                std::uint64_t sum = 0;
+                for (std::size_t i = begin; i < end; i++)
+                    sum += work(i);
+                return sum;
+            }));
+        }
+        std::uint64_t total = 0;
+        for (auto &future : futures)
+            total += future.get();
+        return total;
+    }
+    std::uint64_t sum_sequential(std::size_t length)
+    {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < length; i++)
+            sum += work(i);
+        return sum;
+    }
+
+    //cutoff 아래는 순차로 계산하는 재귀 fibonacci입니다. 작업 수는 두 방식이 같습니다.
+    std::uint64_t fib_sequential(unsigned n)
+    {
+        return n < 2 ? n : fib_sequential(n - 1) + fib_sequential(n - 2);
+    }
+    std::uint64_t fib_fork_join(unsigned n, unsigned cutoff)
+    {
+        if (n <= cutoff)
+            return fib_sequential(n);
+        std::uint64_t left = 0, right = 0;
+        xstl::fork_join([&] { left = fib_fork_join(n - 1, cutoff); }, [&] { right = fib_fork_join(n - 2, cutoff); });
+        return left + right;
+    }
+    std::uint64_t fib_async(unsigned n, unsigned cutoff)
+    {
+        if (n <= cutoff)
+            return fib_sequential(n);
+        auto right = std::async(std::launch::async, fib_async, n - 2, cutoff);
+        std::uint64_t left = fib_async(n - 1, cutoff);
+        return left + right.get();
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t length = argc > 1 ? static_cast<std::size_t>(std::atoll(argv[1])) : (std::size_t(1) << 22);
+    std::printf("%zu elements, %zu pool threads\n", length, xstl::thread_pool::default_pool().size());
+
+    const std::size_t grains[] = {length / 16, length / 256, length / 2048};
+    for (std::size_t grain : grains)
+    {
+        if (grain == 0)
+            continue;
+        char title[64];
+        std::snprintf(title, sizeof(title), "parallel sum, %zu tasks", (length + grain - 1) / grain);
+        bench::title(title);
+
+        std::uint64_t result = 0;
+        bench::report("sequential", bench::best_of(3, [&] { result = sum_sequential(length); }), static_cast<double>(length));
+        bench::report("xstl::parallel_for", bench::best_of(3, [&] { result = sum_with_parallel_for(length, grain); }), static_cast<double>(length));
+        bench::report("std::async per task", bench::best_of(3, [&] { result = sum_with_async(length, grain); }), static_cast<double>(length));
+        bench::keep(result);
+    }
+
+    const unsigned cutoffs[] = {22, 18};
+    for (unsigned cutoff : cutoffs)
+    {
+        const unsigned n = 32;
+        char title[64];
+        std::snprintf(title, sizeof(title), "fib(%u), sequential below %u", n, cutoff);
+        bench::title(title);
+
+        std::uint64_t result = 0;
+        bench::report("sequential", bench::best_of(3, [&] { result = fib_sequential(n); }));
+        bench::report("xstl::fork_join", bench::best_of(3, [&] { result = fib_fork_join(n, cutoff); }));
+        bench::report("std::async", bench::best_of(3, [&] { result = fib_async(n, cutoff); }));
+        bench::keep(result);
+    }
+
+    {
+        bench::title("sort / reduce");
+        std::vector<std::uint64_t> source(length);
+        std::mt19937_64 random(42);
+        for (auto &value : source)
+            value = random();
+
+        std::vector<std::uint64_t> data;
+        auto best_sort = [&](bool parallel) {
+            double best = 0;
+            for (int run = 0; run < 3; run++)
+            {
+                data = source;
+                double elapsed = bench::seconds([&] {
+                    if (parallel)
+                        xstl::par::sort(data.begin(), data.end());
+                    else
+                        std::sort(data.begin(), data.end());
+                });
+                if (run == 0 || elapsed < best)
+                    best = elapsed;
+            }
+            return best;
+        };
+        bench::report("std::sort", best_sort(false), static_cast<double>(length));
+        bench::report("xstl::par::sort", best_sort(true), static_cast<double>(length));
+
+        std::uint64_t sum = 0;
+        bench::report("std::accumulate", bench::best_of(3, [&] { sum = std::accumulate(source.begin(), source.end(), std::uint64_t(0)); }), static_cast<double>(length));
+        bench::report("xstl::par::reduce", bench::best_of(3, [&] { sum = xstl::par::reduce(source.begin(), source.end(), std::uint64_t(0)); }), static_cast<double>(length));
+        bench::keep(sum);
+    }
+
+    return 0;
+}
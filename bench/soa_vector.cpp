@@ -0,0 +1,157 @@
+/*
+    soa_vector against fixed_vector of structs (array of structs).
+    The filters read one or two fields of a 40 byte record, which is the case the column layout is for.
+    The whole-record and sort rows show what the proxy iterators cost when every field is touched.
+    usage: soa_vector [records]
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include "../array/fixed_vector.h"
+#include "../array/soa_vector.h"
+#include "./bench.h"
+
+namespace
+{
+    struct record
+    {
+        std::uint64_t id;
+        double price;
+        double weight;
+        float score;
+        std::int32_t quantity;
+        std::int64_t timestamp;
+    };
+
+    using aos_type = xstl::fixed_vector<record>;
+    using soa_type = xstl::soa_vector<std::uint64_t, double, double, float, std::int32_t, std::int64_t>;
+
+    enum field
+    {
+        field_id,
+        field_price,
+        field_weight,
+        field_score,
+        field_quantity,
+        field_timestamp
+    };
+
+    //soa_vector의 proxy와 value_type(tuple)을 함께 받아야 하므로 template으로 받습니다.
+    struct by_price
+    {
+        bool operator()(const record &left, const record &right) const
+        {
+            return left.price < right.price;
+        }
+        template <class Left, class Right>
+        bool operator()(const Left &left, const Right &right) const
+        {
+            return std::get<field_price>(left) < std::get<field_price>(right);
+        }
+    };
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t length = argc > 1 ? static_cast<std::size_t>(std::atoll(argv[1])) : (std::size_t(1) << 22);
+    std::printf("%zu records of %zu bytes\n", length, sizeof(record));
+
+    aos_type aos(length, xstl::for_overwrite);
+    soa_type soa(length, xstl::for_overwrite);
+    std::mt19937_64 random(7);
+    for (std::size_t i = 0; i < length; i++)
+    {
+        record value{random(), static_cast<double>(random() % 10000) / 100, static_cast<double>(random() % 1000), static_cast<float>(random() % 100), static_cast<std::int32_t>(random() % 50), static_cast<std::int64_t>(i)};
+        aos[i] = value;
+        soa[i] = std::make_tuple(value.id, value.price, value.weight, value.score, value.quantity, value.timestamp);
+    }
+    const double threshold = 50.0;
+    double elements = static_cast<double>(length);
+
+    {
+        bench::title("count(price > threshold), one field");
+        std::size_t count = 0;
+        bench::report("fixed_vector<record>", bench::best_of(5, [&] {
+                          count = 0;
+                          for (std::size_t i = 0; i < length; i++)
+                              count += aos[i].price > threshold;
+                      }),
+                      elements);
+        bench::keep(count);
+        bench::report("soa_vector data<price>()", bench::best_of(5, [&] {
+                          count = 0;
+                          const double *price = soa.data<field_price>();
+                          for (std::size_t i = 0; i < length; i++)
+                              count += price[i] > threshold;
+                      }),
+                      elements);
+        bench::keep(count);
+    }
+
+    {
+        bench::title("sum(quantity) where price > threshold, two fields");
+        std::int64_t sum = 0;
+        bench::report("fixed_vector<record>", bench::best_of(5, [&] {
+                          sum = 0;
+                          for (std::size_t i = 0; i < length; i++)
+                              sum += aos[i].price > threshold ? aos[i].quantity : 0;
+                      }),
+                      elements);
+        bench::keep(sum);
+        bench::report("soa_vector data<>()", bench::best_of(5, [&] {
+                          sum = 0;
+                          const double *price = soa.data<field_price>();
+                          const std::int32_t *quantity = soa.data<field_quantity>();
+                          for (std::size_t i = 0; i < length; i++)
+                              sum += price[i] > threshold ? quantity[i] : 0;
+                      }),
+                      elements);
+        bench::keep(sum);
+        bench::report("soa_vector iterator", bench::best_of(5, [&] {
+                          sum = 0;
+                          for (auto it = soa.cbegin(); it != soa.cend(); ++it)
+                              sum += std::get<field_price>(*it) > threshold ? std::get<field_quantity>(*it) : 0;
+                      }),
+                      elements);
+        bench::keep(sum);
+    }
+
+    {
+        bench::title("sum over every field");
+        double sum = 0;
+        bench::report("fixed_vector<record>", bench::best_of(5, [&] {
+                          sum = 0;
+                          for (const record &value : aos)
+                              sum += value.id + value.price + value.weight + value.score + value.quantity + value.timestamp;
+                      }),
+                      elements);
+        bench::keep(sum);
+        bench::report("soa_vector data<>()", bench::best_of(5, [&] {
+                          sum = 0;
+                          const std::uint64_t *id = soa.data<field_id>();
+                          const double *price = soa.data<field_price>();
+                          const double *weight = soa.data<field_weight>();
+                          const float *score = soa.data<field_score>();
+                          const std::int32_t *quantity = soa.data<field_quantity>();
+                          const std::int64_t *timestamp = soa.data<field_timestamp>();
+                          for (std::size_t i = 0; i < length; i++)
+                              sum += id[i] + price[i] + weight[i] + score[i] + quantity[i] + timestamp[i];
+                      }),
+                      elements);
+        bench::keep(sum);
+    }
+
+    {
+        bench::title("std::sort by price");
+        aos_type aos_copy(aos);
+        soa_type soa_copy(soa);
+        bench::report("fixed_vector<record>", bench::seconds([&] { std::sort(aos_copy.begin(), aos_copy.end(), by_price()); }), elements);
+        bench::report("soa_vector proxy iterator", bench::seconds([&] { std::sort(soa_copy.begin(), soa_copy.end(), by_price()); }), elements);
+        bench::keep(aos_copy[0].id);
+        bench::keep(soa_copy.data<field_id>()[0]);
+    }
+
+    return 0;
+}
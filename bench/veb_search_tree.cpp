@@ -0,0 +1,103 @@
+/*
+    veb_search_tree against a sorted array searched with std::lower_bound, and against std::set.
+    splay_tree does not compile in this tree, so std::set stands in as the pointer based search tree.
+    Every size runs the same 10^6 random lower_bound probes and 10^6 find probes of present keys.
+    std::set needs about 40 bytes a key plus allocator overhead, so it is skipped above set_limit keys.
+    usage: veb_search_tree [keys...]    (default 1000000 10000000; 10^9 keys need about 16 GB)
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+#include "../array/fixed_vector.h"
+#include "../tree/veb_search_tree.h"
+#include "./bench.h"
+
+namespace
+{
+    const std::size_t probe_count = 1000000;
+    const std::size_t set_limit = std::size_t(1) << 25;
+
+    void run(std::size_t count, std::mt19937_64 &random)
+    {
+        xstl::fixed_vector<std::uint64_t> sorted(count, xstl::for_overwrite);
+        for (std::size_t i = 0; i < count; i++)
+            sorted[i] = random();
+        std::sort(sorted.begin(), sorted.end());
+
+        std::vector<std::uint64_t> misses(probe_count), hits(probe_count);
+        for (auto &probe : misses)
+            probe = random();
+        for (auto &probe : hits)
+            probe = sorted[random() % count];
+
+        char title[64];
+        std::snprintf(title, sizeof(title), "%zu keys", count);
+        bench::title(title);
+        double probes = static_cast<double>(probe_count);
+        std::uint64_t sum = 0;
+
+        bench::report("sorted array std::lower_bound", bench::best_of(3, [&] {
+                          for (std::uint64_t key : misses)
+                              sum += std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin();
+                      }),
+                      probes);
+        bench::report("sorted array std::binary_search", bench::best_of(3, [&] {
+                          for (std::uint64_t key : hits)
+                              sum += std::binary_search(sorted.begin(), sorted.end(), key);
+                      }),
+                      probes);
+
+        xstl::veb_search_tree<std::uint64_t> tree;
+        bench::report("veb_search_tree build", bench::seconds([&] { tree.assign(sorted); }), static_cast<double>(count));
+        bench::report("veb_search_tree lower_bound", bench::best_of(3, [&] {
+                          for (std::uint64_t key : misses)
+                              sum += tree.lower_bound(key);
+                      }),
+                      probes);
+        bench::report("veb_search_tree contains", bench::best_of(3, [&] {
+                          for (std::uint64_t key : hits)
+                              sum += tree.contains(key);
+                      }),
+                      probes);
+
+        if (count <= set_limit)
+        {
+            std::set<std::uint64_t> set;
+            bench::report("std::set build", bench::seconds([&] { set.insert(sorted.begin(), sorted.end()); }), static_cast<double>(count));
+            bench::report("std::set lower_bound", bench::best_of(3, [&] {
+                              for (std::uint64_t key : misses)
+                              {
+                                  auto found = set.lower_bound(key);
+                                  sum += found != set.end() ? *found & 1 : 0;
+                              }
+                          }),
+                          probes);
+            bench::report("std::set count", bench::best_of(3, [&] {
+                              for (std::uint64_t key : hits)
+                                  sum += set.count(key);
+                          }),
+                          probes);
+        }
+        bench::keep(sum);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::vector<std::size_t> counts;
+    for (int i = 1; i < argc; i++)
+        counts.push_back(static_cast<std::size_t>(std::atoll(argv[i])));
+    if (counts.empty())
+        counts = {1000000, 10000000};
+
+    std::mt19937_64 random(5);
+    for (std::size_t count : counts)
+        if (count != 0)
+            run(count, random);
+
+    return 0;
+}
@@ -0,0 +1,351 @@
+#ifndef __XSTL_ARC_CACHE__
+#define __XSTL_ARC_CACHE__
+
+/*
+    Adaptive Replacement Cache (Megiddo & Modha).
+    T1 holds entries seen once recently, T2 entries seen at least twice. B1/B2 remember only the keys
+    evicted from T1/T2 ("ghosts"); a hit on a ghost moves the target size p of T1 toward whichever list
+    would have kept it. Sizes are weighted by Weigher, so p, T1+T2 <= capacity and the directory <= 2 * capacity
+    are all measured in weight units. Same interface as lru_cache.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "lru_cache.h"
+
+namespace xstl
+{
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class Weigher = unit_weigher>
+    class arc_cache
+    {
+    public:
+        using Self = arc_cache;
+
+    public: //stl standard type member
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using weigher_type = Weigher;
+
+    private:
+        enum _list_id : unsigned char
+        {
+            _t1,
+            _t2,
+            _b1,
+            _b2
+        };
+
+        //ghost가 되면 value만 파괴하고 key와 weight는 남겨 둡니다.
+        struct _node
+        {
+            using key_type = K;
+
+            circular_list_hook hook;
+            K key;
+            typename std::aligned_storage<sizeof(V), alignof(V)>::type storage;
+            size_type weight;
+            _list_id list;
+
+            template <class Key>
+            _node(Key &&k, size_type w) : key(std::forward<Key>(k)), weight(w), list(_t1)
+            {
+            }
+            ~_node()
+            {
+                if (this->resident())
+                    this->value()->~V();
+            }
+
+            bool resident() const noexcept
+            {
+                return this->list == _t1 || this->list == _t2;
+            }
+            V *value() noexcept
+            {
+                return reinterpret_cast<V *>(&this->storage);
+            }
+        };
+
+        using _list_type = intrusive_circular_list<_node, &_node::hook>;
+
+        //각 list는 front가 가장 최근, back이 가장 오래된 항목입니다.
+        _list_type _lists[4];
+        size_type _weights[4] = {0, 0, 0, 0};
+        flat_hash_set<_node *, _cache_node_hash<_node, Hash>, _cache_node_equal<_node, KeyEqual>> _index;
+        size_type _capacity;
+        size_type _target = 0; //p: T1의 목표 무게
+        size_type _resident_count = 0;
+        cache_stats _stats;
+        Weigher _weigher;
+
+    private:
+        _node *_find(const key_type &key) const
+        {
+            auto found = this->_index.find(key);
+            return found == this->_index.end() ? nullptr : *found;
+        }
+        size_type _resident_weight() const noexcept
+        {
+            return this->_weights[_t1] + this->_weights[_t2];
+        }
+        size_type _directory_weight() const noexcept
+        {
+            return this->_weights[_t1] + this->_weights[_t2] + this->_weights[_b1] + this->_weights[_b2];
+        }
+
+        void _move_to(_node *node, _list_id list)
+        {
+            node->hook.unlink();
+            this->_weights[node->list] -= node->weight;
+            node->list = list;
+            this->_weights[list] += node->weight;
+            this->_lists[list].push_front(*node);
+        }
+        void _remove(_node *node)
+        {
+            this->_index.erase(node->key);
+            this->_weights[node->list] -= node->weight;
+            if (node->resident())
+                this->_resident_count--;
+            delete node;
+        }
+        //resident 항목을 ghost로 내립니다.
+        void _demote(_node *node)
+        {
+            node->value()->~V();
+            this->_resident_count--;
+            this->_move_to(node, node->list == _t1 ? _b1 : _b2);
+            this->_stats.evictions++;
+        }
+
+        //논문의 REPLACE: p를 기준으로 T1 또는 T2의 가장 오래된 항목을 ghost로 내립니다.
+        void _replace(bool hit_in_b2)
+        {
+            size_type t1 = this->_weights[_t1];
+            bool from_t1 = !this->_lists[_t1].empty() && (t1 > this->_target || (hit_in_b2 && t1 >= this->_target) || this->_lists[_t2].empty());
+            this->_demote(&this->_lists[from_t1 ? _t1 : _t2].back());
+        }
+        void _make_room(size_type incoming, bool hit_in_b2)
+        {
+            while (this->_resident_count != 0 && this->_resident_weight() + incoming > this->_capacity)
+                this->_replace(hit_in_b2);
+        }
+        //directory가 2 * capacity를 넘지 않도록 ghost를 버립니다.
+        void _trim_ghosts()
+        {
+            while (this->_directory_weight() > 2 * this->_capacity)
+            {
+                _list_id victim = !this->_lists[_b1].empty() && (this->_weights[_b1] >= this->_weights[_b2] || this->_lists[_b2].empty()) ? _b1 : _b2;
+                if (this->_lists[victim].empty())
+                    break;
+                this->_remove(&this->_lists[victim].back());
+            }
+        }
+
+        template <class Value>
+        void _make_resident(_node *node, Value &&value, _list_id list)
+        {
+            ::new (static_cast<void *>(node->value())) V(std::forward<Value>(value));
+            this->_resident_count++;
+            this->_move_to(node, list);
+        }
+
+    public:
+        explicit arc_cache(size_type capacity, const Weigher &weigher = Weigher(), const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _index(0, _cache_node_hash<_node, Hash>(hash), _cache_node_equal<_node, KeyEqual>(equal)), _capacity(capacity), _weigher(weigher)
+        {
+        }
+        ~arc_cache()
+        {
+            this->_clear_all();
+        }
+
+    public: //not copyable, not movable
+        arc_cache(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public: //lookup
+        //resident 항목이면 T2의 가장 최근으로 올리고 값을 가리킵니다. ghost는 miss입니다.
+        mapped_type *get(const key_type &key)
+        {
+            _node *node = this->_find(key);
+            if (node == nullptr || !node->resident())
+            {
+                this->_stats.misses++;
+                return nullptr;
+            }
+            this->_stats.hits++;
+            this->_move_to(node, _t2);
+            return node->value();
+        }
+        const mapped_type *peek(const key_type &key) const
+        {
+            _node *node = this->_find(key);
+            return node == nullptr || !node->resident() ? nullptr : node->value();
+        }
+        bool contains(const key_type &key) const
+        {
+            _node *node = this->_find(key);
+            return node != nullptr && node->resident();
+        }
+
+    public: //modifiers
+        template <class Value>
+        bool put(const key_type &key, Value &&value)
+        {
+            size_type weight = this->_weigher(key, value);
+            _node *node = this->_find(key);
+            if (weight > this->_capacity)
+            {
+                if (node != nullptr)
+                    this->_remove(node);
+                return false;
+            }
+
+            if (node != nullptr && node->resident())
+            {
+                *node->value() = std::forward<Value>(value);
+                //T1이 비어 있으면 _replace가 T2의 유일한 항목인 자기 자신을 내보낼 수 있으므로,
+                //목록에서 잠시 빼 둔 채 새 무게만큼 자리를 만든 뒤 T2의 front로 다시 겁니다.
+                node->hook.unlink();
+                this->_weights[node->list] -= node->weight;
+                this->_resident_count--;
+                this->_make_room(weight, false);
+                node->weight = weight;
+                node->list = _t2;
+                this->_weights[_t2] += weight;
+                this->_resident_count++;
+                this->_lists[_t2].push_front(*node);
+                return true;
+            }
+
+            if (node != nullptr)
+            {
+                //ghost hit: 이 항목을 남겼을 쪽으로 p를 옮깁니다.
+                bool in_b2 = node->list == _b2;
+                size_type own = this->_weights[node->list];
+                size_type other = this->_weights[in_b2 ? _b1 : _b2];
+                size_type delta = (own != 0 && other > own ? other / own : 1) * node->weight;
+                if (in_b2)
+                    this->_target = this->_target > delta ? this->_target - delta : 0;
+                else
+                    this->_target = this->_capacity - this->_target > delta ? this->_target + delta : this->_capacity;
+
+                this->_weights[node->list] = this->_weights[node->list] - node->weight + weight;
+                node->weight = weight;
+                this->_make_room(weight, in_b2);
+                this->_make_resident(node, std::forward<Value>(value), _t2);
+                this->_trim_ghosts();
+                this->_stats.insertions++;
+                return true;
+            }
+
+            //처음 보는 key: L1 = T1 + B1이 capacity를 넘지 않게 합니다.
+            while (this->_weights[_t1] + this->_weights[_b1] + weight > this->_capacity && !this->_lists[_b1].empty())
+                this->_remove(&this->_lists[_b1].back());
+            while (this->_weights[_t1] + weight > this->_capacity && !this->_lists[_t1].empty())
+            {
+                this->_remove(&this->_lists[_t1].back());
+                this->_stats.evictions++;
+            }
+            this->_make_room(weight, false);
+
+            node = new _node(key, weight);
+            this->_lists[_t1].push_front(*node);
+            this->_weights[_t1] += weight;
+            try
+            {
+                this->_index.insert(node);
+                ::new (static_cast<void *>(node->value())) V(std::forward<Value>(value));
+            }
+            catch (...)
+            {
+                this->_index.erase(node->key);
+                this->_weights[_t1] -= weight;
+                node->list = _b1; //value가 없으므로 소멸자가 파괴하지 않게 합니다.
+                delete node;
+                throw;
+            }
+            this->_resident_count++;
+            this->_trim_ghosts();
+            this->_stats.insertions++;
+            return true;
+        }
+
+        bool erase(const key_type &key)
+        {
+            _node *node = this->_find(key);
+            if (node == nullptr)
+                return false;
+            bool resident = node->resident();
+            this->_remove(node);
+            return resident;
+        }
+
+        //ghost 기록과 p도 함께 비웁니다.
+        void clear()
+        {
+            this->_clear_all();
+            this->_target = 0;
+        }
+
+    private:
+        void _clear_all()
+        {
+            for (_list_type &list : this->_lists)
+                while (!list.empty())
+                    this->_remove(&list.back());
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_resident_count == 0;
+        }
+        //ghost를 뺀 실제 항목 수입니다.
+        size_type size() const noexcept
+        {
+            return this->_resident_count;
+        }
+        size_type weight() const noexcept
+        {
+            return this->_resident_weight();
+        }
+        size_type capacity() const noexcept
+        {
+            return this->_capacity;
+        }
+        //T1의 현재 목표 무게(p)입니다.
+        size_type target_recency_weight() const noexcept
+        {
+            return this->_target;
+        }
+        void set_capacity(size_type capacity)
+        {
+            this->_capacity = capacity;
+            if (this->_target > capacity)
+                this->_target = capacity;
+            this->_make_room(0, false);
+            this->_trim_ghosts();
+        }
+
+    public: //statistics
+        const cache_stats &stats() const noexcept
+        {
+            return this->_stats;
+        }
+        void reset_stats() noexcept
+        {
+            this->_stats = cache_stats();
+        }
+    };
+} // namespace xstl
+
+#endif
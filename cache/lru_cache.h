@@ -0,0 +1,295 @@
+#ifndef __XSTL_LRU_CACHE__
+#define __XSTL_LRU_CACHE__
+
+/*
+    Least Recently Used Cache.
+    One heap node per entry holds the key, the value and the recency list hook.
+    The hash index (flat_hash_set) stores only node pointers and is searched by key directly.
+    Capacity is measured by Weigher (1 per entry by default, or bytes with a user weigher).
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include "../list/intrusive_circular_list.h"
+#include "../hash/flat_hash_set.h"
+
+namespace xstl
+{
+    //모든 cache가 공유하는 적중률 통계입니다.
+    struct cache_stats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t insertions = 0;
+        std::uint64_t evictions = 0;
+
+        double hit_ratio() const noexcept
+        {
+            std::uint64_t total = this->hits + this->misses;
+            return total == 0 ? 0.0 : static_cast<double>(this->hits) / static_cast<double>(total);
+        }
+        cache_stats &operator+=(const cache_stats &other) noexcept
+        {
+            this->hits += other.hits;
+            this->misses += other.misses;
+            this->insertions += other.insertions;
+            this->evictions += other.evictions;
+            return *this;
+        }
+    };
+
+    //항목 하나를 1로 셉니다. capacity가 곧 최대 항목 수가 됩니다.
+    struct unit_weigher
+    {
+        template <class K, class V>
+        std::size_t operator()(const K &, const V &) const noexcept
+        {
+            return 1;
+        }
+    };
+
+    //node 포인터와 key를 모두 받는 transparent hash/equal입니다. index에 key를 따로 저장하지 않기 위함입니다.
+    template <class Node, class Hash>
+    struct _cache_node_hash
+    {
+        using is_transparent = void;
+        Hash hash;
+
+        explicit _cache_node_hash(const Hash &h = Hash()) : hash(h)
+        {
+        }
+        std::size_t operator()(const Node *node) const
+        {
+            return this->hash(node->key);
+        }
+        std::size_t operator()(const typename Node::key_type &key) const
+        {
+            return this->hash(key);
+        }
+    };
+    template <class Node, class KeyEqual>
+    struct _cache_node_equal
+    {
+        using is_transparent = void;
+        KeyEqual equal;
+
+        explicit _cache_node_equal(const KeyEqual &e = KeyEqual()) : equal(e)
+        {
+        }
+        bool operator()(const Node *left, const Node *right) const
+        {
+            return this->equal(left->key, right->key);
+        }
+        bool operator()(const Node *node, const typename Node::key_type &key) const
+        {
+            return this->equal(node->key, key);
+        }
+        bool operator()(const typename Node::key_type &key, const Node *node) const
+        {
+            return this->equal(key, node->key);
+        }
+    };
+
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class Weigher = unit_weigher>
+    class lru_cache
+    {
+    public:
+        using Self = lru_cache;
+
+    public: //stl standard type member
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using weigher_type = Weigher;
+
+    private:
+        struct _node
+        {
+            using key_type = K;
+
+            circular_list_hook hook;
+            K key;
+            V value;
+            size_type weight;
+
+            template <class Key, class Value>
+            _node(Key &&k, Value &&v, size_type w) : key(std::forward<Key>(k)), value(std::forward<Value>(v)), weight(w)
+            {
+            }
+        };
+
+        //front가 가장 최근, back이 가장 오래된 항목입니다.
+        intrusive_circular_list<_node, &_node::hook> _recency;
+        flat_hash_set<_node *, _cache_node_hash<_node, Hash>, _cache_node_equal<_node, KeyEqual>> _index;
+        size_type _capacity;
+        size_type _weight = 0;
+        cache_stats _stats;
+        Weigher _weigher;
+
+    private:
+        _node *_find(const key_type &key) const
+        {
+            auto found = this->_index.find(key);
+            return found == this->_index.end() ? nullptr : *found;
+        }
+        void _touch(_node *node)
+        {
+            node->hook.unlink();
+            this->_recency.push_front(*node);
+        }
+        void _remove(_node *node)
+        {
+            this->_index.erase(node->key);
+            this->_weight -= node->weight;
+            delete node; //hook은 소멸자에서 list에서 빠집니다.
+        }
+        void _evict_to(size_type limit)
+        {
+            while (this->_weight > limit && !this->_recency.empty())
+            {
+                this->_remove(&this->_recency.back());
+                this->_stats.evictions++;
+            }
+        }
+
+    public:
+        explicit lru_cache(size_type capacity, const Weigher &weigher = Weigher(), const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _index(0, _cache_node_hash<_node, Hash>(hash), _cache_node_equal<_node, KeyEqual>(equal)), _capacity(capacity), _weigher(weigher)
+        {
+        }
+        ~lru_cache()
+        {
+            this->clear();
+        }
+
+    public: //move only
+        lru_cache(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+        lru_cache(Self &&) = default;
+
+    public: //lookup
+        //있으면 가장 최근 항목으로 올리고 값을 가리킵니다. 다음 put/erase 전까지만 유효합니다.
+        mapped_type *get(const key_type &key)
+        {
+            _node *node = this->_find(key);
+            if (node == nullptr)
+            {
+                this->_stats.misses++;
+                return nullptr;
+            }
+            this->_stats.hits++;
+            this->_touch(node);
+            return &node->value;
+        }
+        //순서와 통계를 바꾸지 않고 봅니다.
+        const mapped_type *peek(const key_type &key) const
+        {
+            _node *node = this->_find(key);
+            return node == nullptr ? nullptr : &node->value;
+        }
+        bool contains(const key_type &key) const
+        {
+            return this->_find(key) != nullptr;
+        }
+
+    public: //modifiers
+        //넣거나 덮어쓰고, capacity를 넘는 만큼 오래된 항목을 내보냅니다.
+        //무게가 capacity보다 크면 저장하지 않고 (기존 항목도 지우고) false를 돌려줍니다.
+        template <class Value>
+        bool put(const key_type &key, Value &&value)
+        {
+            size_type weight = this->_weigher(key, value);
+            _node *node = this->_find(key);
+            if (weight > this->_capacity)
+            {
+                if (node != nullptr)
+                    this->_remove(node);
+                return false;
+            }
+
+            if (node != nullptr)
+            {
+                node->value = std::forward<Value>(value);
+                this->_weight = this->_weight - node->weight + weight;
+                node->weight = weight;
+                this->_touch(node);
+            }
+            else
+            {
+                node = new _node(key, std::forward<Value>(value), weight);
+                try
+                {
+                    this->_index.insert(node);
+                }
+                catch (...)
+                {
+                    //아직 목록에 걸지 않았으므로 node만 반환하면 됩니다.
+                    delete node;
+                    throw;
+                }
+                this->_recency.push_front(*node);
+                this->_weight += weight;
+                this->_stats.insertions++;
+            }
+
+            this->_evict_to(this->_capacity);
+            return true;
+        }
+
+        bool erase(const key_type &key)
+        {
+            _node *node = this->_find(key);
+            if (node == nullptr)
+                return false;
+            this->_remove(node);
+            return true;
+        }
+
+        void clear()
+        {
+            while (!this->_recency.empty())
+                this->_remove(&this->_recency.back());
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_index.empty();
+        }
+        size_type size() const noexcept
+        {
+            return this->_index.size();
+        }
+        //Weigher 기준 현재 총 무게입니다.
+        size_type weight() const noexcept
+        {
+            return this->_weight;
+        }
+        size_type capacity() const noexcept
+        {
+            return this->_capacity;
+        }
+        //줄이면 즉시 오래된 항목부터 내보냅니다.
+        void set_capacity(size_type capacity)
+        {
+            this->_capacity = capacity;
+            this->_evict_to(capacity);
+        }
+
+    public: //statistics
+        const cache_stats &stats() const noexcept
+        {
+            return this->_stats;
+        }
+        void reset_stats() noexcept
+        {
+            this->_stats = cache_stats();
+        }
+    };
+} // namespace xstl
+
+#endif
@@ -0,0 +1,196 @@
+#ifndef __XSTL_SHARDED_CACHE__
+#define __XSTL_SHARDED_CACHE__
+
+/*
+    Sharded Concurrent Cache.
+    Splits the key space over independent caches (lru_cache, arc_cache, ...), each behind its own mutex
+    on its own cache line. Every shard gets capacity / shard_count, so eviction order is per shard.
+    Values are copied out under the lock because a pointer into a shard would outlive the lock.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "lru_cache.h"
+#include "arc_cache.h"
+#include "../array/allocation_policy.h"
+#include "../hash/flat_hash_table.h"
+
+namespace xstl
+{
+    template <class Cache>
+    class sharded_cache
+    {
+    public:
+        using Self = sharded_cache;
+
+    public: //stl standard type member
+        using cache_type = Cache;
+        using key_type = typename Cache::key_type;
+        using mapped_type = typename Cache::mapped_type;
+        using size_type = typename Cache::size_type;
+        using hasher = typename Cache::hasher;
+        using key_equal = typename Cache::key_equal;
+        using weigher_type = typename Cache::weigher_type;
+
+    private:
+        struct alignas(64) _shard
+        {
+            mutable std::mutex lock;
+            Cache cache;
+
+            _shard(size_type capacity, const weigher_type &weigher, const hasher &hash, const key_equal &equal)
+                : cache(capacity, weigher, hash, equal)
+            {
+            }
+
+            //C++17 전의 new는 alignas(64)를 지키지 않으므로 직접 맞춥니다.
+            static void *operator new(std::size_t bytes)
+            {
+                return aligned_allocation<64>::allocate(bytes, alignof(_shard));
+            }
+            static void operator delete(void *pointer) noexcept
+            {
+                aligned_allocation<64>::deallocate(pointer, sizeof(_shard), alignof(_shard));
+            }
+        };
+
+        std::vector<std::unique_ptr<_shard>> _shards;
+        hasher _hash;
+
+    private:
+        //shard 안의 table과 같은 비트를 쓰지 않도록 섞은 hash의 상위 비트로 고릅니다.
+        _shard &_shard_of(const key_type &key) const
+        {
+            std::uint64_t mixed = _hash_mix(static_cast<std::uint64_t>(this->_hash(key)));
+            return *this->_shards[static_cast<size_type>((mixed >> 32) % this->_shards.size())];
+        }
+
+    public:
+        //capacity는 shard들에 고르게 나눕니다. (나머지는 앞쪽 shard부터 1씩)
+        explicit sharded_cache(size_type capacity, size_type shard_count = 16, const weigher_type &weigher = weigher_type(), const hasher &hash = hasher(),
+                               const key_equal &equal = key_equal())
+            : _hash(hash)
+        {
+            if (shard_count == 0)
+                shard_count = 1;
+            this->_shards.reserve(shard_count);
+            for (size_type i = 0; i < shard_count; i++)
+                this->_shards.emplace_back(new _shard(capacity / shard_count + (i < capacity % shard_count ? 1 : 0), weigher, hash, equal));
+        }
+
+    public: //not copyable, not movable
+        sharded_cache(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public: //lookup
+        //있으면 out에 복사하고 true를 돌려줍니다.
+        bool get(const key_type &key, mapped_type &out)
+        {
+            _shard &shard = this->_shard_of(key);
+            std::lock_guard<std::mutex> guard(shard.lock);
+            mapped_type *found = shard.cache.get(key);
+            if (found == nullptr)
+                return false;
+            out = *found;
+            return true;
+        }
+        bool contains(const key_type &key) const
+        {
+            _shard &shard = this->_shard_of(key);
+            std::lock_guard<std::mutex> guard(shard.lock);
+            return shard.cache.contains(key);
+        }
+
+    public: //modifiers
+        template <class Value>
+        bool put(const key_type &key, Value &&value)
+        {
+            _shard &shard = this->_shard_of(key);
+            std::lock_guard<std::mutex> guard(shard.lock);
+            return shard.cache.put(key, std::forward<Value>(value));
+        }
+        bool erase(const key_type &key)
+        {
+            _shard &shard = this->_shard_of(key);
+            std::lock_guard<std::mutex> guard(shard.lock);
+            return shard.cache.erase(key);
+        }
+        void clear()
+        {
+            for (auto &shard : this->_shards)
+            {
+                std::lock_guard<std::mutex> guard(shard->lock);
+                shard->cache.clear();
+            }
+        }
+
+    public: //capacity
+        //다른 thread가 동작 중이면 근사값입니다.
+        size_type size() const
+        {
+            size_type total = 0;
+            for (auto &shard : this->_shards)
+            {
+                std::lock_guard<std::mutex> guard(shard->lock);
+                total += shard->cache.size();
+            }
+            return total;
+        }
+        size_type weight() const
+        {
+            size_type total = 0;
+            for (auto &shard : this->_shards)
+            {
+                std::lock_guard<std::mutex> guard(shard->lock);
+                total += shard->cache.weight();
+            }
+            return total;
+        }
+        size_type capacity() const
+        {
+            size_type total = 0;
+            for (auto &shard : this->_shards)
+            {
+                std::lock_guard<std::mutex> guard(shard->lock);
+                total += shard->cache.capacity();
+            }
+            return total;
+        }
+        size_type shard_count() const noexcept
+        {
+            return this->_shards.size();
+        }
+
+    public: //statistics
+        cache_stats stats() const
+        {
+            cache_stats total;
+            for (auto &shard : this->_shards)
+            {
+                std::lock_guard<std::mutex> guard(shard->lock);
+                total += shard->cache.stats();
+            }
+            return total;
+        }
+        void reset_stats()
+        {
+            for (auto &shard : this->_shards)
+            {
+                std::lock_guard<std::mutex> guard(shard->lock);
+                shard->cache.reset_stats();
+            }
+        }
+    };
+
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class Weigher = unit_weigher>
+    using concurrent_lru_cache = sharded_cache<lru_cache<K, V, Hash, KeyEqual, Weigher>>;
+
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class Weigher = unit_weigher>
+    using concurrent_arc_cache = sharded_cache<arc_cache<K, V, Hash, KeyEqual, Weigher>>;
+} // namespace xstl
+
+#endif
@@ -0,0 +1,646 @@
+#ifndef __XSTL_CONCURRENT_HASH_MAP__
+#define __XSTL_CONCURRENT_HASH_MAP__
+
+/*
+    Concurrent Sharded Hash Map.
+    Keys are split into cache-line padded shards by hash. Each shard is a linear probing table.
+    Readers never lock: they copy the entry under the shard's seqlock and retry if a writer got in between.
+    Writers take the shard's mutex, so writers on different shards never wait for each other.
+    Growing a shard allocates a new table and moves a few slots on every later write to that shard,
+    so no single operation rehashes a whole shard and other shards are never touched.
+
+    K and V must be trivially copyable, since readers copy entries that a writer may be changing.
+    KeyEqual may see a torn key during such a race (the result is then thrown away), so it must not dereference.
+    Replaced tables are freed by epoch based reclamation. A lookup publishes the global epoch in its thread's
+    record while it runs, and a retired table is deleted by a later write once every published epoch is newer
+    than the one it was retired in.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "../array/fixed_vector.h"
+#include "./flat_hash_table.h" //_hash_mix
+
+namespace xstl
+{
+    //thread마다 하나씩 두는 reader 기록입니다. 0이면 읽는 중이 아니고, 아니면 읽기 시작할 때의 epoch입니다.
+    struct alignas(64) _epoch_record
+    {
+        std::atomic<std::uint64_t> epoch{0};
+        std::atomic<bool> in_use{true};
+        _epoch_record *next = nullptr;
+    };
+
+    //모든 concurrent_hash_map이 공유하는 epoch입니다. 기록은 thread가 끝나면 재사용하고 해제하지 않습니다.
+    class _epoch_domain
+    {
+    private:
+        std::atomic<std::uint64_t> _epoch{1};
+        std::atomic<_epoch_record *> _records{nullptr};
+
+        struct _local_handle
+        {
+            _epoch_record *record = nullptr;
+            ~_local_handle()
+            {
+                if (this->record != nullptr)
+                    this->record->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        _epoch_record *_acquire()
+        {
+            for (_epoch_record *record = this->_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+                if (!record->in_use.load(std::memory_order_relaxed) && !record->in_use.exchange(true, std::memory_order_acquire))
+                    return record;
+
+            //C++17 이전의 new는 64 byte 정렬을 보장하지 않습니다.
+            void *memory = aligned_allocation<alignof(_epoch_record)>::allocate(sizeof(_epoch_record), alignof(_epoch_record));
+            _epoch_record *record = ::new (memory) _epoch_record();
+            _epoch_record *head = this->_records.load(std::memory_order_relaxed);
+            do
+                record->next = head;
+            while (!this->_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+            return record;
+        }
+
+    public:
+        //static 소멸 순서와 상관없이 thread_local 정리가 접근할 수 있도록 해제하지 않습니다.
+        static _epoch_domain &instance()
+        {
+            static _epoch_domain *domain = new _epoch_domain();
+            return *domain;
+        }
+        static _epoch_record &local()
+        {
+            thread_local _local_handle handle;
+            if (handle.record == nullptr)
+                handle.record = instance()._acquire();
+            return *handle.record;
+        }
+
+        std::uint64_t current() const noexcept
+        {
+            return this->_epoch.load(std::memory_order_acquire);
+        }
+        //unlink한 뒤에 부릅니다. 돌려준 epoch 이하를 기록한 reader만 그 객체를 보고 있을 수 있습니다.
+        std::uint64_t retire() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return this->_epoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+        //읽는 중인 reader가 기록한 가장 오래된 epoch입니다. 없으면 최댓값입니다.
+        std::uint64_t oldest_active() const noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::uint64_t oldest = ~std::uint64_t(0);
+            for (_epoch_record *record = this->_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+            {
+                std::uint64_t epoch = record->epoch.load(std::memory_order_seq_cst);
+                if (epoch != 0 && epoch < oldest)
+                    oldest = epoch;
+            }
+            return oldest;
+        }
+    };
+
+    //lookup 동안 이 thread의 기록에 현재 epoch를 올려 둡니다. 중첩되면 바깥 구간의 epoch를 유지합니다.
+    class _epoch_read_section
+    {
+    private:
+        _epoch_record &_record;
+        bool _outer;
+
+    public:
+        _epoch_read_section() : _record(_epoch_domain::local()), _outer(_record.epoch.load(std::memory_order_relaxed) == 0)
+        {
+            if (!this->_outer)
+                return;
+            this->_record.epoch.store(_epoch_domain::instance().current(), std::memory_order_seq_cst);
+            //기록한 뒤에 table 포인터를 읽어야 reclaim하는 쪽이 이 기록을 놓치지 않습니다.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        ~_epoch_read_section()
+        {
+            if (this->_outer)
+                this->_record.epoch.store(0, std::memory_order_release);
+        }
+
+        _epoch_read_section(const _epoch_read_section &) = delete;
+        _epoch_read_section &operator=(const _epoch_read_section &) = delete;
+    };
+
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>>
+    class concurrent_hash_map
+    {
+        static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                      "concurrent_hash_map requires trivially copyable keys and values");
+
+    public:
+        using Self = concurrent_hash_map;
+
+    public: //stl standard type member
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<K, V>;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+    private:
+        struct _entry
+        {
+            K key;
+            V value;
+        };
+
+        static constexpr size_type _word_count = (sizeof(_entry) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+        static constexpr size_type _migrate_step = 64;
+        static constexpr size_type _min_capacity = 16;
+
+        //tag: 0은 빈 slot, 1은 지운 slot, 2 이상은 (hash | 2)입니다.
+        enum : std::uint64_t
+        {
+            _tag_empty = 0,
+            _tag_deleted = 1,
+        };
+
+        //entry는 word 단위 relaxed atomic으로 읽고 씁니다. seqlock 재시도와 함께 쓰면 data race가 아닙니다.
+        struct _slot
+        {
+            std::atomic<std::uint64_t> tag;
+            std::atomic<std::uint64_t> words[_word_count];
+        };
+
+        struct _table
+        {
+            size_type capacity; //2^n
+            std::unique_ptr<_slot[]> slots;
+            std::uint64_t retired_epoch = 0;
+            _table *next_retired = nullptr; //은퇴 목록을 할당 없이 잇습니다.
+
+            explicit _table(size_type c) : capacity(c), slots(new _slot[c]())
+            {
+            }
+        };
+
+        struct alignas(64) _shard
+        {
+            std::atomic<std::uint64_t> sequence{0}; //홀수면 writer가 수정 중입니다.
+            std::atomic<_table *> table{nullptr};
+            std::atomic<_table *> old_table{nullptr}; //옮기는 중인 이전 table입니다.
+            std::atomic<size_type> size{0};
+
+            std::mutex lock;
+            size_type used = 0;           //table의 full + deleted slot 수
+            size_type migrate_cursor = 0; //old_table에서 다음에 옮길 slot
+            _table *retired = nullptr;    //reader가 아직 볼 수 있는 이전 table들입니다.
+
+            _shard() = default;
+            ~_shard()
+            {
+                delete this->table.load(std::memory_order_relaxed);
+                delete this->old_table.load(std::memory_order_relaxed);
+                while (this->retired != nullptr)
+                {
+                    _table *next = this->retired->next_retired;
+                    delete this->retired;
+                    this->retired = next;
+                }
+            }
+        };
+
+        fixed_vector<_shard, aligned_allocation<64>> _shards;
+        size_type _shard_shift = 64;
+        Hash _hash;
+        KeyEqual _equal;
+
+    private: //hash helper
+        std::uint64_t _hash_of(const key_type &key) const
+        {
+            return _hash_mix(static_cast<std::uint64_t>(this->_hash(key)));
+        }
+        //상위 bit로 shard를, 하위 bit로 slot을 고릅니다.
+        _shard &_shard_of(std::uint64_t hash) const
+        {
+            size_type index = this->_shard_shift >= 64 ? 0 : static_cast<size_type>(hash >> this->_shard_shift);
+            return const_cast<_shard &>(this->_shards[index]);
+        }
+        static std::uint64_t _tag_of(std::uint64_t hash) noexcept
+        {
+            return hash | 2;
+        }
+
+    private: //slot access
+        static _entry _load(const _slot &slot) noexcept
+        {
+            std::uint64_t words[_word_count];
+            for (size_type i = 0; i < _word_count; i++)
+                words[i] = slot.words[i].load(std::memory_order_relaxed);
+            _entry entry;
+            std::memcpy(&entry, words, sizeof(_entry));
+            return entry;
+        }
+        static void _store(_slot &slot, const _entry &entry) noexcept
+        {
+            std::uint64_t words[_word_count] = {};
+            std::memcpy(words, &entry, sizeof(_entry));
+            for (size_type i = 0; i < _word_count; i++)
+                slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+
+        //key가 있는 slot index, 없으면 capacity입니다. reader와 writer 모두 씁니다.
+        size_type _probe(const _table *table, const key_type &key, std::uint64_t hash, _entry *found) const
+        {
+            if (table == nullptr)
+                return 0;
+
+            std::uint64_t tag = _tag_of(hash);
+            size_type mask = table->capacity - 1;
+            for (size_type i = 0, index = hash & mask; i < table->capacity; i++, index = (index + 1) & mask)
+            {
+                std::uint64_t current = table->slots[index].tag.load(std::memory_order_relaxed);
+                if (current == _tag_empty)
+                    break;
+                if (current != tag)
+                    continue;
+
+                _entry entry = _load(table->slots[index]);
+                if (this->_equal(entry.key, key))
+                {
+                    if (found != nullptr)
+                        *found = entry;
+                    return index;
+                }
+            }
+            return table->capacity;
+        }
+
+    private: //reclamation (shard lock를 잡은 상태에서 부릅니다)
+        //reader가 볼 수 없게 떼어낸 table을 은퇴 목록에 올립니다.
+        static void _retire(_shard &shard, _table *table) noexcept
+        {
+            if (table == nullptr)
+                return;
+            table->retired_epoch = _epoch_domain::instance().retire();
+            table->next_retired = shard.retired;
+            shard.retired = table;
+        }
+        //은퇴한 뒤에 시작한 reader만 남은 table을 해제합니다.
+        static void _reclaim(_shard &shard) noexcept
+        {
+            if (shard.retired == nullptr)
+                return;
+
+            std::uint64_t oldest = _epoch_domain::instance().oldest_active();
+            for (_table **link = &shard.retired; *link != nullptr;)
+            {
+                _table *table = *link;
+                if (table->retired_epoch < oldest)
+                {
+                    *link = table->next_retired;
+                    delete table;
+                }
+                else
+                    link = &table->next_retired;
+            }
+        }
+
+    private: //writer helper (shard lock를 잡은 상태에서 부릅니다)
+        struct _write_section
+        {
+            _shard &shard;
+
+            explicit _write_section(_shard &s) : shard(s)
+            {
+                std::uint64_t sequence = this->shard.sequence.load(std::memory_order_relaxed);
+                this->shard.sequence.store(sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+            ~_write_section()
+            {
+                std::uint64_t sequence = this->shard.sequence.load(std::memory_order_relaxed);
+                this->shard.sequence.store(sequence + 1, std::memory_order_release);
+            }
+        };
+
+        //새 key를 넣을 자리입니다. 지운 slot을 재사용합니다.
+        static size_type _find_free(const _table *table, std::uint64_t hash) noexcept
+        {
+            size_type mask = table->capacity - 1;
+            size_type index = hash & mask;
+            while (table->slots[index].tag.load(std::memory_order_relaxed) > _tag_deleted)
+                index = (index + 1) & mask;
+            return index;
+        }
+
+        void _place(_shard &shard, _table *table, const _entry &entry, std::uint64_t hash)
+        {
+            size_type index = _find_free(table, hash);
+            _slot &slot = table->slots[index];
+            if (slot.tag.load(std::memory_order_relaxed) == _tag_empty)
+                shard.used++;
+            _store(slot, entry);
+            slot.tag.store(_tag_of(hash), std::memory_order_relaxed);
+        }
+
+        //old_table에서 limit개 slot을 현재 table로 옮깁니다. 다 옮기면 old_table을 은퇴시킵니다.
+        void _migrate(_shard &shard, size_type limit)
+        {
+            _table *old_table = shard.old_table.load(std::memory_order_relaxed);
+            if (old_table == nullptr)
+                return;
+
+            _table *table = shard.table.load(std::memory_order_relaxed);
+            for (; limit > 0 && shard.migrate_cursor < old_table->capacity; limit--, shard.migrate_cursor++)
+            {
+                _slot &slot = old_table->slots[shard.migrate_cursor];
+                if (slot.tag.load(std::memory_order_relaxed) <= _tag_deleted)
+                    continue;
+
+                _entry entry = _load(slot);
+                this->_place(shard, table, entry, this->_hash_of(entry.key));
+                slot.tag.store(_tag_deleted, std::memory_order_relaxed);
+            }
+
+            if (shard.migrate_cursor == old_table->capacity)
+            {
+                shard.old_table.store(nullptr, std::memory_order_relaxed);
+                _retire(shard, old_table);
+            }
+        }
+
+        //부하율 1/2을 넘으면 live 요소의 4배 크기 table로 바꾸고 옮기기를 시작합니다.
+        void _reserve_one(_shard &shard)
+        {
+            _table *table = shard.table.load(std::memory_order_relaxed);
+            if (table != nullptr && (shard.used + 1) * 2 <= table->capacity)
+                return;
+
+            //이전 이동이 끝나지 않았다면 마저 끝냅니다. 이 shard 하나에만 해당합니다.
+            this->_migrate(shard, ~size_type(0));
+
+            size_type capacity = _min_capacity;
+            while (capacity < shard.size.load(std::memory_order_relaxed) * 4)
+                capacity *= 2;
+
+            _table *grown = new _table(capacity);
+            shard.old_table.store(table, std::memory_order_relaxed);
+            shard.table.store(grown, std::memory_order_release);
+            shard.used = 0;
+            shard.migrate_cursor = 0;
+        }
+
+        //key를 현재 table 또는 old_table에서 찾습니다. 반환값은 (table, index)이며 없으면 table이 nullptr입니다.
+        std::pair<_table *, size_type> _locate(_shard &shard, const key_type &key, std::uint64_t hash, _entry *found) const
+        {
+            _table *table = shard.table.load(std::memory_order_relaxed);
+            size_type index = this->_probe(table, key, hash, found);
+            if (table != nullptr && index != table->capacity)
+                return {table, index};
+
+            _table *old_table = shard.old_table.load(std::memory_order_relaxed);
+            index = this->_probe(old_table, key, hash, found);
+            if (old_table != nullptr && index != old_table->capacity)
+                return {old_table, index};
+
+            return {nullptr, 0};
+        }
+
+        //Function(bool exists, V &value) -> bool(write). value를 고쳐 쓰거나 새로 넣을지를 정합니다.
+        template <class Function>
+        bool _write(const key_type &key, Function function)
+        {
+            std::uint64_t hash = this->_hash_of(key);
+            _shard &shard = this->_shard_of(hash);
+            std::lock_guard<std::mutex> guard(shard.lock);
+
+            _entry entry;
+            auto location = this->_locate(shard, key, hash, &entry);
+            bool exists = location.first != nullptr;
+            if (!exists)
+                entry.key = key;
+
+            if (!function(exists, entry.value))
+                return exists;
+
+            _write_section section(shard);
+            if (exists)
+            {
+                _store(location.first->slots[location.second], entry);
+            }
+            else
+            {
+                this->_reserve_one(shard);
+                this->_place(shard, shard.table.load(std::memory_order_relaxed), entry, hash);
+                shard.size.fetch_add(1, std::memory_order_relaxed);
+            }
+            this->_migrate(shard, _migrate_step);
+            _reclaim(shard);
+            return exists;
+        }
+
+    public:
+        //shard_count는 2의 거듭제곱으로 올림합니다. 동시에 쓰는 thread 수보다 넉넉하게 잡습니다.
+        explicit concurrent_hash_map(size_type shard_count = 64, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _hash(hash), _equal(equal)
+        {
+            size_type count = 1;
+            size_type bits = 0;
+            while (count < shard_count)
+            {
+                count *= 2;
+                bits++;
+            }
+            this->_shard_shift = 64 - bits;
+            this->_shards = fixed_vector<_shard, aligned_allocation<64>>(count, for_overwrite);
+        }
+        //다른 thread가 아직 이 map을 읽고 있으면 안 됩니다.
+        ~concurrent_hash_map() = default;
+
+    public: //not copyable, not movable
+        concurrent_hash_map(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public: //lookup (lock-free)
+        //찾으면 value에 복사하고 true를 돌려줍니다.
+        bool find(const key_type &key, mapped_type &value) const
+        {
+            std::uint64_t hash = this->_hash_of(key);
+            _shard &shard = this->_shard_of(hash);
+
+            _epoch_read_section section;
+            while (true)
+            {
+                std::uint64_t before = shard.sequence.load(std::memory_order_acquire);
+                if (before & 1)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                _table *table = shard.table.load(std::memory_order_acquire);
+                _table *old_table = shard.old_table.load(std::memory_order_acquire);
+                _entry entry;
+                size_type index = this->_probe(table, key, hash, &entry);
+                bool found = table != nullptr && index != table->capacity;
+                if (!found && old_table != nullptr)
+                    found = this->_probe(old_table, key, hash, &entry) != old_table->capacity;
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (shard.sequence.load(std::memory_order_relaxed) != before)
+                    continue;
+
+                if (found)
+                    value = entry.value;
+                return found;
+            }
+        }
+        bool contains(const key_type &key) const
+        {
+            mapped_type ignored;
+            return this->find(key, ignored);
+        }
+        mapped_type value_or(const key_type &key, const mapped_type &fallback) const
+        {
+            mapped_type value;
+            return this->find(key, value) ? value : fallback;
+        }
+
+    public: //modifiers (per-shard lock)
+        //key가 없을 때만 넣습니다. 넣었으면 true입니다.
+        bool insert(const key_type &key, const mapped_type &value)
+        {
+            return !this->_write(key, [&](bool exists, mapped_type &slot) {
+                if (exists)
+                    return false;
+                slot = value;
+                return true;
+            });
+        }
+        //새로 넣었으면 true, 덮어썼으면 false입니다.
+        bool insert_or_assign(const key_type &key, const mapped_type &value)
+        {
+            return !this->_write(key, [&](bool, mapped_type &slot) {
+                slot = value;
+                return true;
+            });
+        }
+        //key가 있을 때 function(V &)로 값을 고칩니다. shard lock 안에서 실행되므로 짧아야 합니다.
+        template <class Function>
+        bool update(const key_type &key, Function function)
+        {
+            return this->_write(key, [&](bool exists, mapped_type &slot) {
+                if (!exists)
+                    return false;
+                function(slot);
+                return true;
+            });
+        }
+
+        bool erase(const key_type &key)
+        {
+            std::uint64_t hash = this->_hash_of(key);
+            _shard &shard = this->_shard_of(hash);
+            std::lock_guard<std::mutex> guard(shard.lock);
+
+            auto location = this->_locate(shard, key, hash, nullptr);
+            if (location.first == nullptr)
+                return false;
+
+            _write_section section(shard);
+            location.first->slots[location.second].tag.store(_tag_deleted, std::memory_order_relaxed);
+            shard.size.fetch_sub(1, std::memory_order_relaxed);
+            this->_migrate(shard, _migrate_step);
+            _reclaim(shard);
+            return true;
+        }
+
+        //각 shard를 빈 table로 바꿉니다. 이전 table은 읽던 reader가 모두 빠져나가면 해제됩니다.
+        void clear()
+        {
+            for (size_type i = 0; i < this->_shards.size(); i++)
+            {
+                _shard &shard = this->_shards[i];
+                std::lock_guard<std::mutex> guard(shard.lock);
+                {
+                    _write_section section(shard);
+                    _table *table = shard.table.load(std::memory_order_relaxed);
+                    _table *old_table = shard.old_table.load(std::memory_order_relaxed);
+                    shard.table.store(nullptr, std::memory_order_release);
+                    shard.old_table.store(nullptr, std::memory_order_relaxed);
+                    shard.size.store(0, std::memory_order_relaxed);
+                    shard.used = 0;
+                    shard.migrate_cursor = 0;
+                    _retire(shard, table);
+                    _retire(shard, old_table);
+                }
+                _reclaim(shard);
+            }
+        }
+
+        //은퇴한 table 중 해제할 수 있는 것을 지금 해제합니다. 쓰기마다 자동으로 하므로 보통은 부를 필요가 없습니다.
+        void reclaim()
+        {
+            for (size_type i = 0; i < this->_shards.size(); i++)
+            {
+                _shard &shard = this->_shards[i];
+                std::lock_guard<std::mutex> guard(shard.lock);
+                _reclaim(shard);
+            }
+        }
+
+    public: //traversal
+        //shard마다 lock을 잡고 function(const K &, const V &)를 부릅니다. shard 사이에서는 일관된 snapshot이 아닙니다.
+        template <class Function>
+        void for_each(Function function) const
+        {
+            for (size_type i = 0; i < this->_shards.size(); i++)
+            {
+                _shard &shard = const_cast<_shard &>(this->_shards[i]);
+                std::lock_guard<std::mutex> guard(shard.lock);
+                _table *tables[2] = {shard.table.load(std::memory_order_relaxed), shard.old_table.load(std::memory_order_relaxed)};
+                for (_table *table : tables)
+                {
+                    if (table == nullptr)
+                        continue;
+                    for (size_type j = 0; j < table->capacity; j++)
+                    {
+                        if (table->slots[j].tag.load(std::memory_order_relaxed) <= _tag_deleted)
+                            continue;
+                        _entry entry = _load(table->slots[j]);
+                        function(static_cast<const K &>(entry.key), static_cast<const V &>(entry.value));
+                    }
+                }
+            }
+        }
+
+    public: //capacity
+        //동시에 수정 중이라면 근사값입니다.
+        size_type size() const noexcept
+        {
+            size_type total = 0;
+            for (size_type i = 0; i < this->_shards.size(); i++)
+                total += this->_shards[i].size.load(std::memory_order_relaxed);
+            return total;
+        }
+        bool empty() const noexcept
+        {
+            return this->size() == 0;
+        }
+        size_type shard_count() const noexcept
+        {
+            return this->_shards.size();
+        }
+    };
+} // namespace xstl
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef __XSTL_FLAT_HASH_MAP__
+#define __XSTL_FLAT_HASH_MAP__
+
+/*
+    Open Addressing Hash Map.
+    Keys and values are stored inline in one flat slot array (no node per element).
+    Inserting or erasing may move elements, so references and iterators are invalidated by rehash.
+    See flat_hash_table.h for the layout.
+*/
+
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "./flat_hash_table.h"
+
+namespace xstl
+{
+    template <class K, class V>
+    struct _flat_hash_map_policy
+    {
+        using key_type = K;
+        using value_type = std::pair<const K, V>;
+        using reference = value_type &;
+
+        static const K &key(const value_type &value) noexcept
+        {
+            return value.first;
+        }
+        //rehash 중 옮기는 원본은 곧 파괴되므로 const key도 move합니다.
+        static void transfer(value_type *destination, value_type *source)
+        {
+            ::new (static_cast<void *>(destination)) value_type(std::move(const_cast<K &>(source->first)), std::move(source->second));
+            source->~value_type();
+        }
+    };
+
+    template <class K, class V, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class Allocation = default_allocation>
+    class flat_hash_map : public _flat_hash_table<_flat_hash_map_policy<K, V>, Hash, KeyEqual, Allocation>
+    {
+    private:
+        using _base = _flat_hash_table<_flat_hash_map_policy<K, V>, Hash, KeyEqual, Allocation>;
+        template <class Key>
+        using _key_arg = typename _base::template _key_arg<Key>;
+
+    public:
+        using Self = flat_hash_map;
+
+    public: //stl standard type member
+        using key_type = K;
+        using mapped_type = V;
+        using typename _base::value_type;
+        using typename _base::size_type;
+        using typename _base::iterator;
+        using typename _base::const_iterator;
+
+    public:
+        using _base::_base;
+        flat_hash_map() = default;
+        flat_hash_map(std::initializer_list<value_type> init, size_type bucket_count = 0, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _base(init, bucket_count, hash, equal)
+        {
+        }
+
+    public: //element access
+        mapped_type &operator[](const key_type &key)
+        {
+            return this->try_emplace(key).first->second;
+        }
+        mapped_type &operator[](key_type &&key)
+        {
+            return this->try_emplace(std::move(key)).first->second;
+        }
+        template <class Key = key_type>
+        mapped_type &at(const _key_arg<Key> &key)
+        {
+            auto it = this->template find<Key>(key);
+            if (it == this->end())
+                throw std::out_of_range("flat_hash_map::at");
+            return it->second;
+        }
+        template <class Key = key_type>
+        const mapped_type &at(const _key_arg<Key> &key) const
+        {
+            auto it = this->template find<Key>(key);
+            if (it == this->end())
+                throw std::out_of_range("flat_hash_map::at");
+            return it->second;
+        }
+
+    public: //modifiers
+        using _base::insert;
+
+        //key가 없을 때만 mapped_type(args...)를 만듭니다. 있으면 args는 건드리지 않습니다.
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type &key, Args &&... args)
+        {
+            auto result = this->_find_or_prepare_insert(key);
+            if (result.second)
+                this->_construct_at(result.first, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            return {this->_iterator_at(result.first), result.second};
+        }
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(key_type &&key, Args &&... args)
+        {
+            auto result = this->_find_or_prepare_insert(key);
+            if (result.second)
+                this->_construct_at(result.first, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+            return {this->_iterator_at(result.first), result.second};
+        }
+
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&value)
+        {
+            auto result = this->try_emplace(key, std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(key_type &&key, M &&value)
+        {
+            auto result = this->try_emplace(std::move(key), std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        //(key, value) 형태 인자는 pair를 만들지 않고 바로 자리를 찾습니다.
+        template <class Key, class... Args>
+        std::pair<iterator, bool> emplace(Key &&key, Args &&... args)
+        {
+            return this->_emplace(std::integral_constant<bool, sizeof...(Args) == 1 && std::is_same<typename std::decay<Key>::type, key_type>::value>(),
+                                  std::forward<Key>(key), std::forward<Args>(args)...);
+        }
+
+    private:
+        template <class Key, class Mapped>
+        std::pair<iterator, bool> _emplace(std::true_type, Key &&key, Mapped &&mapped)
+        {
+            return this->try_emplace(std::forward<Key>(key), std::forward<Mapped>(mapped));
+        }
+        template <class... Args>
+        std::pair<iterator, bool> _emplace(std::false_type, Args &&... args)
+        {
+            return this->insert(value_type(std::forward<Args>(args)...));
+        }
+    };
+
+    template <class K, class V, class Hash, class KeyEqual, class Allocation>
+    bool operator==(const flat_hash_map<K, V, Hash, KeyEqual, Allocation> &left, const flat_hash_map<K, V, Hash, KeyEqual, Allocation> &right)
+    {
+        if (left.size() != right.size())
+            return false;
+        for (const auto &entry : left)
+        {
+            auto found = right.find(entry.first);
+            if (found == right.end() || !(found->second == entry.second))
+                return false;
+        }
+        return true;
+    }
+    template <class K, class V, class Hash, class KeyEqual, class Allocation>
+    bool operator!=(const flat_hash_map<K, V, Hash, KeyEqual, Allocation> &left, const flat_hash_map<K, V, Hash, KeyEqual, Allocation> &right)
+    {
+        return !(left == right);
+    }
+} // namespace xstl
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef __XSTL_FLAT_HASH_SET__
+#define __XSTL_FLAT_HASH_SET__
+
+/*
+    Open Addressing Hash Set.
+    Keys are stored inline in one flat slot array (no node per element).
+    Iterators are invalidated by rehash. See flat_hash_table.h for the layout.
+*/
+
+#include <functional>
+#include <utility>
+#include "./flat_hash_table.h"
+
+namespace xstl
+{
+    template <class K>
+    struct _flat_hash_set_policy
+    {
+        using key_type = K;
+        using value_type = K;
+        using reference = const value_type &; //key는 수정할 수 없습니다.
+
+        static const K &key(const value_type &value) noexcept
+        {
+            return value;
+        }
+        static void transfer(value_type *destination, value_type *source)
+        {
+            ::new (static_cast<void *>(destination)) value_type(std::move(*source));
+            source->~value_type();
+        }
+    };
+
+    template <class K, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>, class Allocation = default_allocation>
+    class flat_hash_set : public _flat_hash_table<_flat_hash_set_policy<K>, Hash, KeyEqual, Allocation>
+    {
+    private:
+        using _base = _flat_hash_table<_flat_hash_set_policy<K>, Hash, KeyEqual, Allocation>;
+
+    public:
+        using Self = flat_hash_set;
+
+    public:
+        using typename _base::value_type;
+        using typename _base::size_type;
+        using typename _base::iterator;
+        using typename _base::const_iterator;
+
+    public:
+        using _base::_base;
+        flat_hash_set() = default;
+        flat_hash_set(std::initializer_list<value_type> init, size_type bucket_count = 0, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _base(init, bucket_count, hash, equal)
+        {
+        }
+
+    public: //modifiers
+        using _base::insert;
+
+        //transparent hash라면 key_type으로 바꿀 수 있는 값을, 없을 때만 변환해서 넣습니다.
+        template <class Key, class = typename std::enable_if<!std::is_same<typename std::decay<Key>::type, value_type>::value &&
+                                                               _base::template _is_transparent<Hash, KeyEqual>::value>::type>
+        std::pair<iterator, bool> insert(Key &&key)
+        {
+            auto result = this->_find_or_prepare_insert(key);
+            if (result.second)
+                this->_construct_at(result.first, std::forward<Key>(key));
+            return {this->_iterator_at(result.first), result.second};
+        }
+    };
+
+    template <class K, class Hash, class KeyEqual, class Allocation>
+    bool operator==(const flat_hash_set<K, Hash, KeyEqual, Allocation> &left, const flat_hash_set<K, Hash, KeyEqual, Allocation> &right)
+    {
+        if (left.size() != right.size())
+            return false;
+        for (const auto &key : left)
+            if (!right.contains(key))
+                return false;
+        return true;
+    }
+    template <class K, class Hash, class KeyEqual, class Allocation>
+    bool operator!=(const flat_hash_set<K, Hash, KeyEqual, Allocation> &left, const flat_hash_set<K, Hash, KeyEqual, Allocation> &right)
+    {
+        return !(left == right);
+    }
+} // namespace xstl
+
+#endif
@@ -0,0 +1,879 @@
+#ifndef __XSTL_FLAT_HASH_TABLE__
+#define __XSTL_FLAT_HASH_TABLE__
+
+/*
+    Open Addressing Hash Table (Swiss table layout).
+    Shared implementation of flat_hash_map and flat_hash_set.
+
+    Every slot has one control byte: empty, deleted, sentinel, or the low 7 bits (H2) of a full slot's hash.
+    A probe loads a group of control bytes (16 with SSE2, 8 otherwise) and matches H2 against all of them at once.
+    The first group_width - 1 control bytes are cloned after the sentinel so a group can be loaded from any slot.
+    capacity is always 2^n - 1 and the load factor is kept at or below 7/8.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../array/allocation_policy.h"
+#include "../utility/bit_operation.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define __XSTL_HASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace xstl
+{
+    //full slot은 0~127(H2), 나머지는 음수입니다. sentinel은 iterator가 끝을 알아보는 데 씁니다.
+    enum _hash_ctrl : std::int8_t
+    {
+        _ctrl_empty = -128,
+        _ctrl_deleted = -2,
+        _ctrl_sentinel = -1,
+    };
+
+    //group 안에서 조건에 맞는 slot 위치들입니다. slot 하나가 (1 << shift) bit를 차지합니다.
+    template <unsigned Shift>
+    class _hash_bitmask
+    {
+    private:
+        std::uint64_t _mask;
+
+    public:
+        explicit _hash_bitmask(std::uint64_t mask) noexcept : _mask(mask)
+        {
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return this->_mask != 0;
+        }
+        unsigned lowest() const noexcept
+        {
+            return this->trailing_zeros();
+        }
+        void remove_lowest() noexcept
+        {
+            this->_mask &= this->_mask - 1;
+        }
+        unsigned trailing_zeros() const noexcept
+        {
+            return _count_trailing_zero64(this->_mask) >> Shift;
+        }
+        //group 폭 기준으로 센 상위 빈 slot 수입니다.
+        unsigned leading_zeros(unsigned width) const noexcept
+        {
+            return (_count_leading_zero64(this->_mask) - (64 - (width << Shift))) >> Shift;
+        }
+    };
+
+#if defined(__XSTL_HASH_SSE2)
+    struct _hash_group
+    {
+        static constexpr std::size_t width = 16;
+        using bitmask = _hash_bitmask<0>;
+
+        __m128i ctrl;
+
+        explicit _hash_group(const std::int8_t *position) noexcept
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(position)))
+        {
+        }
+
+        bitmask match(std::int8_t h2) const noexcept
+        {
+            return bitmask(static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->ctrl))));
+        }
+        bitmask match_empty() const noexcept
+        {
+            return this->match(_ctrl_empty);
+        }
+        //signed 비교로 empty, deleted를 함께 찾습니다. (ctrl < sentinel)
+        bitmask match_empty_or_deleted() const noexcept
+        {
+            return bitmask(static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(_ctrl_sentinel), this->ctrl))));
+        }
+    };
+#else
+    //SIMD 없이 64bit 정수 하나로 8개 control byte를 비교합니다. 각 byte의 최상위 bit가 결과입니다.
+    struct _hash_group
+    {
+        static constexpr std::size_t width = 8;
+        using bitmask = _hash_bitmask<3>;
+
+        std::uint64_t ctrl;
+
+        explicit _hash_group(const std::int8_t *position) noexcept : ctrl(0)
+        {
+            for (std::size_t i = 0; i < width; i++)
+                this->ctrl |= std::uint64_t(static_cast<std::uint8_t>(position[i])) << (i * 8);
+        }
+
+        //뒤따르는 byte에서 거짓 양성이 나올 수 있지만 key 비교로 걸러집니다.
+        bitmask match(std::int8_t h2) const noexcept
+        {
+            const std::uint64_t lsbs = 0x0101010101010101ull;
+            const std::uint64_t msbs = 0x8080808080808080ull;
+            std::uint64_t x = this->ctrl ^ (lsbs * static_cast<std::uint8_t>(h2));
+            return bitmask((x - lsbs) & ~x & msbs);
+        }
+        bitmask match_empty() const noexcept
+        {
+            return bitmask((this->ctrl & ~(this->ctrl << 6)) & 0x8080808080808080ull);
+        }
+        bitmask match_empty_or_deleted() const noexcept
+        {
+            return bitmask((this->ctrl & ~(this->ctrl << 7)) & 0x8080808080808080ull);
+        }
+    };
+#endif
+
+    //빈 table은 할당 없이 이 group을 가리킵니다.
+    inline const std::int8_t *_hash_empty_group() noexcept
+    {
+        alignas(16) static const std::int8_t group[16] = {
+            _ctrl_sentinel, _ctrl_empty, _ctrl_empty, _ctrl_empty,
+            _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty,
+            _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty,
+            _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty};
+        return group;
+    }
+
+    //std::hash<int> 같은 항등 hash도 H1/H2로 나눠 쓸 수 있도록 bit를 섞습니다. (murmur3 finalizer)
+    inline std::uint64_t _hash_mix(std::uint64_t hash) noexcept
+    {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    //lookup 함수의 인자 형식입니다. 중첩 alias template이어야 Key가 인자에서 추론됩니다.
+    template <bool Transparent>
+    struct _hash_key_arg
+    {
+        template <class Key, class KeyType>
+        using type = Key;
+    };
+    template <>
+    struct _hash_key_arg<false>
+    {
+        template <class Key, class KeyType>
+        using type = KeyType;
+    };
+
+    //Policy는 value_type, key_type, reference, key(value), transfer(dst, src)를 제공합니다.
+    template <class Policy, class Hash, class KeyEqual, class Allocation>
+    class _flat_hash_table
+    {
+    public:
+        using Self = _flat_hash_table;
+
+    public: //stl standard type member
+        using key_type = typename Policy::key_type;
+        using value_type = typename Policy::value_type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocation_type = Allocation;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        class iterator;
+        class const_iterator;
+
+    protected:
+        template <class...>
+        struct _void
+        {
+            using type = void;
+        };
+        //Hash와 KeyEqual이 모두 is_transparent를 가지면 key_type으로 바꾸지 않고 바로 찾습니다.
+        template <class H, class E, class = void>
+        struct _is_transparent : std::false_type
+        {
+        };
+        template <class H, class E>
+        struct _is_transparent<H, E, typename _void<typename H::is_transparent, typename E::is_transparent>::type> : std::true_type
+        {
+        };
+        template <class Key>
+        using _key_arg = typename _hash_key_arg<_is_transparent<Hash, KeyEqual>::value>::template type<Key, key_type>;
+
+    private:
+        static constexpr size_type _cloned_bytes = _hash_group::width - 1;
+
+        std::int8_t *_ctrl = const_cast<std::int8_t *>(_hash_empty_group());
+        value_type *_slots = nullptr;
+        size_type _size = 0;
+        size_type _capacity = 0;
+        size_type _growth_left = 0;
+        Hash _hash;
+        KeyEqual _equal;
+
+    private: //capacity helper
+        //n 이상인 가장 작은 2^k - 1 입니다.
+        static size_type _normalize_capacity(size_type n) noexcept
+        {
+            return n == 0 ? 1 : static_cast<size_type>(~std::uint64_t(0) >> _count_leading_zero64(n));
+        }
+        //최대 부하율 7/8
+        static size_type _capacity_to_growth(size_type capacity) noexcept
+        {
+            if (_hash_group::width == 8 && capacity == 7)
+                return 6;
+            return capacity - capacity / 8;
+        }
+        static size_type _growth_to_capacity(size_type growth) noexcept
+        {
+            if (_hash_group::width == 8 && growth == 7)
+                return 8;
+            return growth + (growth == 0 ? 0 : (growth - 1) / 7);
+        }
+
+        static size_type _slot_offset(size_type capacity) noexcept
+        {
+            size_type ctrl_bytes = capacity + 1 + _cloned_bytes;
+            return (ctrl_bytes + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+        }
+        static size_type _allocation_size(size_type capacity) noexcept
+        {
+            return _slot_offset(capacity) + capacity * sizeof(value_type);
+        }
+        //control byte를 16byte 단위로 읽으므로 최소 16에 맞춥니다.
+        static constexpr size_type _allocation_alignment() noexcept
+        {
+            return alignof(value_type) < 16 ? 16 : alignof(value_type);
+        }
+
+    private: //control byte helper
+        static bool _is_full(std::int8_t ctrl) noexcept
+        {
+            return ctrl >= 0;
+        }
+        static bool _is_empty_or_deleted(std::int8_t ctrl) noexcept
+        {
+            return ctrl < _ctrl_sentinel;
+        }
+
+        template <class Key>
+        std::uint64_t _hash_of(const Key &key) const
+        {
+            return _hash_mix(static_cast<std::uint64_t>(this->_hash(key)));
+        }
+        static size_type _h1(std::uint64_t hash) noexcept
+        {
+            return static_cast<size_type>(hash >> 7);
+        }
+        static std::int8_t _h2(std::uint64_t hash) noexcept
+        {
+            return static_cast<std::int8_t>(hash & 0x7F);
+        }
+
+        //index의 control byte를 쓰고, 앞쪽 slot이면 sentinel 뒤 복제본도 함께 씁니다.
+        void _set_ctrl(size_type index, std::int8_t value) noexcept
+        {
+            this->_ctrl[index] = value;
+            this->_ctrl[((index - _cloned_bytes) & this->_capacity) + (_cloned_bytes & this->_capacity)] = value;
+        }
+
+        //H1에서 시작해 group 폭만큼씩 늘어나는 간격(삼각수)으로 탐색합니다. 2^k 크기에서 모든 group을 한 번씩 봅니다.
+        struct _probe_sequence
+        {
+            size_type mask;
+            size_type offset;
+            size_type index = 0;
+
+            _probe_sequence(size_type hash, size_type m) noexcept : mask(m), offset(hash & m)
+            {
+            }
+            size_type slot(size_type i) const noexcept
+            {
+                return (this->offset + i) & this->mask;
+            }
+            void next() noexcept
+            {
+                this->index += _hash_group::width;
+                this->offset = (this->offset + this->index) & this->mask;
+            }
+        };
+
+    private:
+        template <class Key>
+        size_type _find_index(const Key &key, std::uint64_t hash) const
+        {
+            std::int8_t h2 = _h2(hash);
+            _probe_sequence sequence(_h1(hash), this->_capacity);
+            while (true)
+            {
+                _hash_group group(this->_ctrl + sequence.offset);
+                for (auto match = group.match(h2); match; match.remove_lowest())
+                {
+                    size_type index = sequence.slot(match.lowest());
+                    if (this->_equal(Policy::key(this->_slots[index]), key))
+                        return index;
+                }
+                if (group.match_empty())
+                    return this->_capacity;
+                sequence.next();
+            }
+        }
+
+        //hash의 탐색 경로에서 처음 만나는 empty 또는 deleted slot입니다.
+        size_type _find_first_non_full(std::uint64_t hash) const noexcept
+        {
+            _probe_sequence sequence(_h1(hash), this->_capacity);
+            while (true)
+            {
+                auto mask = _hash_group(this->_ctrl + sequence.offset).match_empty_or_deleted();
+                if (mask)
+                    return sequence.slot(mask.lowest());
+                sequence.next();
+            }
+        }
+
+        void _initialize(size_type capacity)
+        {
+            void *memory = Allocation::allocate(_allocation_size(capacity), _allocation_alignment());
+            this->_ctrl = static_cast<std::int8_t *>(memory);
+            this->_slots = reinterpret_cast<value_type *>(static_cast<char *>(memory) + _slot_offset(capacity));
+            this->_capacity = capacity;
+            std::memset(this->_ctrl, _ctrl_empty, capacity + 1 + _cloned_bytes);
+            this->_ctrl[capacity] = _ctrl_sentinel;
+            this->_growth_left = _capacity_to_growth(capacity) - this->_size;
+        }
+
+        void _release() noexcept
+        {
+            if (this->_capacity != 0)
+                Allocation::deallocate(this->_ctrl, _allocation_size(this->_capacity), _allocation_alignment());
+            this->_ctrl = const_cast<std::int8_t *>(_hash_empty_group());
+            this->_slots = nullptr;
+            this->_capacity = 0;
+            this->_growth_left = 0;
+        }
+
+        void _destroy_slots() noexcept
+        {
+            if (!std::is_trivially_destructible<value_type>::value)
+                for (size_type i = 0; i < this->_capacity; i++)
+                    if (_is_full(this->_ctrl[i]))
+                        this->_slots[i].~value_type();
+        }
+
+        //새 배열로 옮깁니다. 같은 capacity로 부르면 deleted slot만 정리됩니다.
+        void _resize(size_type capacity)
+        {
+            std::int8_t *old_ctrl = this->_ctrl;
+            value_type *old_slots = this->_slots;
+            size_type old_capacity = this->_capacity;
+
+            this->_initialize(capacity);
+            for (size_type i = 0; i < old_capacity; i++)
+            {
+                if (!_is_full(old_ctrl[i]))
+                    continue;
+                std::uint64_t hash = this->_hash_of(Policy::key(old_slots[i]));
+                size_type index = this->_find_first_non_full(hash);
+                this->_set_ctrl(index, _h2(hash));
+                Policy::transfer(this->_slots + index, old_slots + i);
+            }
+
+            if (old_capacity != 0)
+                Allocation::deallocate(old_ctrl, _allocation_size(old_capacity), _allocation_alignment());
+        }
+
+        void _rehash_and_grow()
+        {
+            if (this->_capacity == 0)
+                this->_resize(1);
+            //deleted가 많아 자리가 없는 경우라면 크기를 유지한 채 정리만 합니다.
+            else if (this->_capacity > _hash_group::width && this->_size * 32 <= this->_capacity * 25)
+                this->_resize(this->_capacity);
+            else
+                this->_resize(this->_capacity * 2 + 1);
+        }
+
+    protected:
+        //key가 있으면 (그 위치, false), 없으면 새 값을 넣을 자리를 잡고 (그 위치, true)를 돌려줍니다.
+        //true인 경우 호출자는 반드시 _slots[index]에 값을 생성해야 합니다.
+        template <class Key>
+        std::pair<size_type, bool> _find_or_prepare_insert(const Key &key)
+        {
+            std::uint64_t hash = this->_hash_of(key);
+            size_type found = this->_find_index(key, hash);
+            if (found != this->_capacity)
+                return {found, false};
+
+            size_type index = this->_find_first_non_full(hash);
+            if (this->_growth_left == 0 && this->_ctrl[index] != _ctrl_deleted)
+            {
+                this->_rehash_and_grow();
+                index = this->_find_first_non_full(hash);
+            }
+
+            this->_growth_left -= this->_ctrl[index] == _ctrl_empty;
+            this->_set_ctrl(index, _h2(hash));
+            this->_size++;
+            return {index, true};
+        }
+
+        //_find_or_prepare_insert로 잡은 자리에 값을 생성합니다. 생성 중 예외가 나면 자리를 다시 비웁니다.
+        template <class... Args>
+        void _construct_at(size_type index, Args &&... args)
+        {
+            try
+            {
+                ::new (static_cast<void *>(this->_slots + index)) value_type(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                this->_erase_meta(index);
+                throw;
+            }
+        }
+
+        iterator _iterator_at(size_type index) noexcept
+        {
+            return iterator(this->_ctrl + index, this->_slots + index);
+        }
+        const_iterator _iterator_at(size_type index) const noexcept
+        {
+            return const_iterator(this->_ctrl + index, this->_slots + index);
+        }
+
+        void _erase_at(size_type index) noexcept
+        {
+            this->_slots[index].~value_type();
+            this->_erase_meta(index);
+        }
+
+        //값은 건드리지 않고 control byte만 지웁니다.
+        void _erase_meta(size_type index) noexcept
+        {
+            this->_size--;
+
+            //index 앞뒤 group에 empty가 있고 그 사이 연속된 full 구간이 group 폭보다 짧다면,
+            //이 slot에서 탐색이 group 하나를 꽉 채운 채 지나간 적이 없으므로 empty로 되돌려도 됩니다.
+            size_type index_before = (index - _hash_group::width) & this->_capacity;
+            auto empty_after = _hash_group(this->_ctrl + index).match_empty();
+            auto empty_before = _hash_group(this->_ctrl + index_before).match_empty();
+            bool was_never_full = empty_before && empty_after &&
+                                  empty_after.trailing_zeros() + empty_before.leading_zeros(_hash_group::width) < _hash_group::width;
+
+            this->_set_ctrl(index, was_never_full ? _ctrl_empty : _ctrl_deleted);
+            this->_growth_left += was_never_full;
+        }
+
+    public:
+        _flat_hash_table() = default;
+        explicit _flat_hash_table(size_type bucket_count, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _hash(hash), _equal(equal)
+        {
+            if (bucket_count != 0)
+                this->_initialize(_normalize_capacity(bucket_count));
+        }
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        _flat_hash_table(InputIterator begin, InputIterator end, size_type bucket_count = 0, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _flat_hash_table(bucket_count, hash, equal)
+        {
+            this->insert(begin, end);
+        }
+        _flat_hash_table(std::initializer_list<value_type> init, size_type bucket_count = 0, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual())
+            : _flat_hash_table(init.begin(), init.end(), bucket_count, hash, equal)
+        {
+        }
+        ~_flat_hash_table()
+        {
+            this->_destroy_slots();
+            this->_release();
+        }
+
+    public: //copy & move
+        _flat_hash_table(const Self &other) : _hash(other._hash), _equal(other._equal)
+        {
+            this->reserve(other._size);
+            for (const auto &value : other)
+            {
+                std::uint64_t hash = this->_hash_of(Policy::key(value));
+                size_type index = this->_find_first_non_full(hash);
+                ::new (static_cast<void *>(this->_slots + index)) value_type(value);
+                this->_set_ctrl(index, _h2(hash));
+                this->_growth_left--;
+                this->_size++;
+            }
+        }
+        _flat_hash_table(Self &&other) noexcept : _hash(std::move(other._hash)), _equal(std::move(other._equal))
+        {
+            this->_swap_storage(other);
+        }
+        Self &operator=(const Self &other)
+        {
+            if (this != &other)
+            {
+                Self copied(other);
+                this->swap(copied);
+            }
+            return *this;
+        }
+        Self &operator=(Self &&other) noexcept
+        {
+            if (this != &other)
+            {
+                this->clear();
+                this->_release();
+                this->_hash = std::move(other._hash);
+                this->_equal = std::move(other._equal);
+                this->_swap_storage(other);
+            }
+            return *this;
+        }
+
+    private:
+        void _swap_storage(Self &other) noexcept
+        {
+            std::swap(this->_ctrl, other._ctrl);
+            std::swap(this->_slots, other._slots);
+            std::swap(this->_size, other._size);
+            std::swap(this->_capacity, other._capacity);
+            std::swap(this->_growth_left, other._growth_left);
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_size == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_size;
+        }
+        size_type capacity() const noexcept
+        {
+            return this->_capacity;
+        }
+        float load_factor() const noexcept
+        {
+            return this->_capacity == 0 ? 0.0f : static_cast<float>(this->_size) / static_cast<float>(this->_capacity);
+        }
+
+        //count개를 rehash 없이 넣을 수 있게 합니다.
+        void reserve(size_type count)
+        {
+            if (count > this->_size + this->_growth_left)
+                this->_resize(_normalize_capacity(_growth_to_capacity(count)));
+        }
+        //bucket_count와 현재 크기를 모두 담을 수 있는 capacity로 다시 배치합니다. 0이면 최소 크기로 줄입니다.
+        void rehash(size_type bucket_count)
+        {
+            size_type needed = std::max(bucket_count, _growth_to_capacity(this->_size));
+            if (needed == 0)
+            {
+                if (this->_capacity != 0 && this->_size == 0)
+                    this->_release();
+                return;
+            }
+            size_type capacity = _normalize_capacity(needed);
+            if (capacity != this->_capacity)
+                this->_resize(capacity);
+        }
+
+    public: //modifiers
+        //메모리는 유지합니다.
+        void clear() noexcept
+        {
+            if (this->_capacity == 0)
+                return;
+            this->_destroy_slots();
+            std::memset(this->_ctrl, _ctrl_empty, this->_capacity + 1 + _cloned_bytes);
+            this->_ctrl[this->_capacity] = _ctrl_sentinel;
+            this->_size = 0;
+            this->_growth_left = _capacity_to_growth(this->_capacity);
+        }
+
+        std::pair<iterator, bool> insert(const value_type &value)
+        {
+            auto result = this->_find_or_prepare_insert(Policy::key(value));
+            if (result.second)
+                this->_construct_at(result.first, value);
+            return {this->_iterator_at(result.first), result.second};
+        }
+        std::pair<iterator, bool> insert(value_type &&value)
+        {
+            auto result = this->_find_or_prepare_insert(Policy::key(value));
+            if (result.second)
+                this->_construct_at(result.first, std::move(value));
+            return {this->_iterator_at(result.first), result.second};
+        }
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        void insert(InputIterator begin, InputIterator end)
+        {
+            for (; begin != end; ++begin)
+                this->emplace(*begin);
+        }
+        void insert(std::initializer_list<value_type> init)
+        {
+            this->insert(init.begin(), init.end());
+        }
+
+        //key를 알기 위해 값을 먼저 만듭니다. 이미 있는 key라면 만든 값은 버려집니다.
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&... args)
+        {
+            return this->insert(value_type(std::forward<Args>(args)...));
+        }
+
+        template <class Key = key_type>
+        size_type erase(const _key_arg<Key> &key)
+        {
+            size_type index = this->_find_index(key, this->_hash_of(key));
+            if (index == this->_capacity)
+                return 0;
+            this->_erase_at(index);
+            return 1;
+        }
+        //다음 요소를 가리키는 iterator를 돌려줍니다.
+        iterator erase(const_iterator position) noexcept
+        {
+            size_type index = static_cast<size_type>(position.slot - this->_slots);
+            this->_erase_at(index);
+            iterator next = this->_iterator_at(index);
+            ++next;
+            return next;
+        }
+        iterator erase(iterator position) noexcept
+        {
+            return this->erase(const_iterator(position));
+        }
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            while (first != last)
+                first = this->erase(first);
+            return this->_iterator_at(static_cast<size_type>(last.slot - this->_slots));
+        }
+
+        void swap(Self &other) noexcept
+        {
+            std::swap(this->_hash, other._hash);
+            std::swap(this->_equal, other._equal);
+            this->_swap_storage(other);
+        }
+
+    public: //lookup
+        template <class Key = key_type>
+        iterator find(const _key_arg<Key> &key)
+        {
+            return this->_iterator_at(this->_find_index(key, this->_hash_of(key)));
+        }
+        template <class Key = key_type>
+        const_iterator find(const _key_arg<Key> &key) const
+        {
+            return this->_iterator_at(this->_find_index(key, this->_hash_of(key)));
+        }
+        template <class Key = key_type>
+        bool contains(const _key_arg<Key> &key) const
+        {
+            return this->_find_index(key, this->_hash_of(key)) != this->_capacity;
+        }
+        template <class Key = key_type>
+        size_type count(const _key_arg<Key> &key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        hasher hash_function() const
+        {
+            return this->_hash;
+        }
+        key_equal key_eq() const
+        {
+            return this->_equal;
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            iterator it(this->_ctrl, this->_slots);
+            it._skip_empty_or_deleted();
+            return it;
+        }
+        const_iterator begin() const noexcept
+        {
+            return this->cbegin();
+        }
+        const_iterator cbegin() const noexcept
+        {
+            const_iterator it(this->_ctrl, this->_slots);
+            it._skip_empty_or_deleted();
+            return it;
+        }
+        iterator end() noexcept
+        {
+            return this->_iterator_at(this->_capacity);
+        }
+        const_iterator end() const noexcept
+        {
+            return this->cend();
+        }
+        const_iterator cend() const noexcept
+        {
+            return this->_iterator_at(this->_capacity);
+        }
+
+    public:
+        //slot 배열 순서로 돕니다. rehash가 일어나면 모든 iterator가 무효화됩니다.
+        class iterator
+        {
+        public:
+            using Self = iterator;
+            friend _flat_hash_table;
+            friend const_iterator;
+
+        public:
+            using value_type = _flat_hash_table::value_type;
+            using reference = typename Policy::reference;
+            using pointer = typename std::remove_reference<reference>::type *;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+        private:
+            const std::int8_t *ctrl = nullptr;
+            _flat_hash_table::value_type *slot = nullptr;
+
+            iterator(const std::int8_t *c, _flat_hash_table::value_type *s) noexcept : ctrl(c), slot(s)
+            {
+            }
+            void _skip_empty_or_deleted() noexcept
+            {
+                while (_is_empty_or_deleted(*this->ctrl))
+                {
+                    this->ctrl++;
+                    this->slot++;
+                }
+            }
+
+        public:
+            iterator() = default;
+
+        public: //move operator
+            Self &operator++() noexcept
+            {
+                this->ctrl++;
+                this->slot++;
+                this->_skip_empty_or_deleted();
+                return *this;
+            }
+            Self operator++(int) noexcept
+            {
+                Self temp = *this;
+                ++*this;
+                return temp;
+            }
+
+        public: //access operator
+            reference operator*() const noexcept
+            {
+                return *this->slot;
+            }
+            pointer operator->() const noexcept
+            {
+                return this->slot;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const noexcept
+            {
+                return this->ctrl == other.ctrl;
+            }
+            bool operator!=(const Self &other) const noexcept
+            {
+                return this->ctrl != other.ctrl;
+            }
+        };
+
+        class const_iterator
+        {
+        public:
+            using Self = const_iterator;
+            friend _flat_hash_table;
+
+        public:
+            using value_type = _flat_hash_table::value_type;
+            using reference = const value_type &;
+            using pointer = const value_type *;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+        private:
+            const std::int8_t *ctrl = nullptr;
+            const value_type *slot = nullptr;
+
+            const_iterator(const std::int8_t *c, const value_type *s) noexcept : ctrl(c), slot(s)
+            {
+            }
+            void _skip_empty_or_deleted() noexcept
+            {
+                while (_is_empty_or_deleted(*this->ctrl))
+                {
+                    this->ctrl++;
+                    this->slot++;
+                }
+            }
+
+        public:
+            const_iterator() = default;
+            const_iterator(const iterator &mutable_iterator) noexcept : ctrl(mutable_iterator.ctrl), slot(mutable_iterator.slot)
+            {
+            }
+
+        public: //move operator
+            Self &operator++() noexcept
+            {
+                this->ctrl++;
+                this->slot++;
+                this->_skip_empty_or_deleted();
+                return *this;
+            }
+            Self operator++(int) noexcept
+            {
+                Self temp = *this;
+                ++*this;
+                return temp;
+            }
+
+        public: //access operator
+            reference operator*() const noexcept
+            {
+                return *this->slot;
+            }
+            pointer operator->() const noexcept
+            {
+                return this->slot;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const noexcept
+            {
+                return this->ctrl == other.ctrl;
+            }
+            bool operator!=(const Self &other) const noexcept
+            {
+                return this->ctrl != other.ctrl;
+            }
+        };
+    };
+} // namespace xstl
+
+#endif
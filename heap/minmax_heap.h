@@ -0,0 +1,293 @@
+#ifndef __XSTL_MINMAX_HEAP__
+#define __XSTL_MINMAX_HEAP__
+
+/*
+    Min-Max Heap (Double-Ended Priority Queue).
+    Even levels are ordered as a min heap, odd levels as a max heap.
+    Both ends are accessible in O(1) and removable in O(log n).
+*/
+
+#include <vector>
+#include <algorithm>  //sort
+#include <functional> //less
+#include <utility>
+#include <cassert>
+
+namespace xstl
+{
+    template <class T, class Compare = std::less<T>, class Container = std::vector<T>>
+    class minmax_heap
+    {
+    public:
+        using Self = minmax_heap;
+
+    public:
+        using container_type = Container;
+        using value_type = typename Container::value_type;
+        using size_type = typename Container::size_type;
+        using reference = typename Container::reference;
+        using const_reference = typename Container::const_reference;
+        using pointer = typename Container::pointer;
+        using const_pointer = typename Container::const_pointer;
+
+    private:
+        Container _container;
+
+    private: //index helper
+        static size_type _parent(size_type index)
+        {
+            return (index - 1) / 2;
+        }
+        static size_type _grand_parent(size_type index)
+        {
+            return (index - 3) / 4;
+        }
+        static bool _is_min_level(size_type index)
+        {
+            //level = floor(log2(index + 1)), min level은 짝수 level입니다.
+            bool min_level = true;
+            for (++index; index > 1; index >>= 1)
+                min_level = !min_level;
+            return min_level;
+        }
+
+        //max level에서는 비교 방향을 뒤집습니다.
+        bool _ordered(size_type left, size_type right, bool max_level) const
+        {
+            return max_level ? Compare()(_container[right], _container[left])
+                             : Compare()(_container[left], _container[right]);
+        }
+
+        size_type _max_index() const
+        {
+            assert(!_container.empty());
+
+            if (_container.size() == 1)
+                return 0;
+            if (_container.size() == 2)
+                return 1;
+            return Compare()(_container[1], _container[2]) ? 2 : 1;
+        }
+
+    private:
+        void _push_up(size_type index)
+        {
+            if (index == 0)
+                return;
+
+            using std::swap;
+            size_type parent = _parent(index);
+            bool max_level = !_is_min_level(index);
+
+            //부모가 반대 방향 level이므로, 순서가 어긋나면 부모 쪽 level로 올려보냅니다.
+            if (_ordered(parent, index, max_level))
+            {
+                swap(_container[index], _container[parent]);
+                this->_push_up_level(parent, !max_level);
+            }
+            else
+                this->_push_up_level(index, max_level);
+        }
+        void _push_up_level(size_type index, bool max_level)
+        {
+            using std::swap;
+            while (index >= 3)
+            {
+                size_type grand_parent = _grand_parent(index);
+                if (!_ordered(index, grand_parent, max_level))
+                    break;
+                swap(_container[index], _container[grand_parent]);
+                index = grand_parent;
+            }
+        }
+
+        void _push_down(size_type index)
+        {
+            using std::swap;
+            bool max_level = !_is_min_level(index);
+            size_type length = _container.size();
+
+            while (true)
+            {
+                size_type first_child = index * 2 + 1;
+                if (first_child >= length)
+                    return;
+
+                //자식과 손자 중 가장 앞서는 요소를 찾습니다.
+                size_type target = first_child;
+                if (first_child + 1 < length && _ordered(first_child + 1, target, max_level))
+                    target = first_child + 1;
+
+                size_type first_grand_child = first_child * 2 + 1;
+                size_type last_grand_child = std::min(first_grand_child + 4, length);
+                for (size_type i = first_grand_child; i < last_grand_child; i++)
+                    if (_ordered(i, target, max_level))
+                        target = i;
+
+                if (!_ordered(target, index, max_level))
+                    return;
+
+                swap(_container[target], _container[index]);
+
+                if (target < first_grand_child) //자식이면 더 내려갈 곳이 없습니다.
+                    return;
+
+                size_type parent = _parent(target);
+                if (_ordered(parent, target, max_level))
+                    swap(_container[target], _container[parent]);
+
+                index = target;
+            }
+        }
+
+        void _make_heap()
+        {
+            for (size_type i = _container.size() / 2; i > 0; i--)
+                this->_push_down(i - 1);
+        }
+
+        void _erase_at(size_type index)
+        {
+            if (index + 1 != _container.size())
+            {
+                _container[index] = std::move(_container.back());
+                _container.pop_back();
+                this->_push_down(index);
+            }
+            else
+                _container.pop_back();
+        }
+
+    public:
+        minmax_heap() = default;
+        virtual ~minmax_heap() = default;
+
+    public: //기본 생성/대입자
+        minmax_heap(const Self &) = default;
+        minmax_heap(Self &&) = default;
+        Self &operator=(const Self &) = default;
+        Self &operator=(Self &&) = default;
+
+    public: //constructor
+        minmax_heap(std::initializer_list<value_type> init) : _container(init)
+        {
+            this->_make_heap();
+        }
+        template <class InputIterator>
+        minmax_heap(InputIterator begin, InputIterator end) : _container(begin, end)
+        {
+            this->_make_heap();
+        }
+        minmax_heap(size_type count, const_reference value) : _container(count, value)
+        {
+        }
+
+        Self &operator=(std::initializer_list<value_type> init)
+        {
+            _container = init;
+            this->_make_heap();
+            return *this;
+        }
+
+    public:
+        void assign(size_type count, const_reference value)
+        {
+            _container.assign(count, value);
+        }
+        void assign(std::initializer_list<value_type> init)
+        {
+            _container.assign(init);
+            this->_make_heap();
+        }
+        template <class InputIterator>
+        void assign(InputIterator begin, InputIterator end)
+        {
+            _container.assign(begin, end);
+            this->_make_heap();
+        }
+
+    public: //container와의 호환용
+        minmax_heap(const Container &vec) : _container(vec)
+        {
+            this->_make_heap();
+        }
+        minmax_heap(Container &&vec) : _container(std::move(vec))
+        {
+            this->_make_heap();
+        }
+        operator const Container &() const
+        {
+            return this->_container;
+        }
+
+    public: //return sorted container
+        Container sorted() const
+        {
+            Container clone = this->_container;
+            std::sort(clone.begin(), clone.end(), Compare());
+            return clone;
+        }
+
+    public: //Compare 기준으로 가장 앞/뒤 요소를 가져옵니다.
+        const_reference front_min() const
+        {
+            assert(!_container.empty());
+            return _container.front();
+        }
+        const_reference front_max() const
+        {
+            return _container[this->_max_index()];
+        }
+
+    public: //요소를 추가합니다.
+        void push(const_reference value)
+        {
+            _container.push_back(value);
+            this->_push_up(_container.size() - 1);
+        }
+        void push(value_type &&value)
+        {
+            _container.push_back(std::move(value));
+            this->_push_up(_container.size() - 1);
+        }
+        template <class... Args>
+        void emplace(Args &&... args)
+        {
+            _container.emplace_back(std::forward<Args>(args)...);
+            this->_push_up(_container.size() - 1);
+        }
+
+    public: //최소/최대값을 제거합니다.
+        void pop_min()
+        {
+            assert(!_container.empty());
+            this->_erase_at(0);
+        }
+        void pop_max()
+        {
+            this->_erase_at(this->_max_index());
+        }
+
+    public:
+        void clear() noexcept
+        {
+            return _container.clear();
+        }
+        void swap(Self &other) noexcept
+        {
+            this->_container.swap(other._container);
+        }
+
+    public:
+        bool empty() const noexcept
+        {
+            return _container.empty();
+        }
+        size_type size() const noexcept
+        {
+            return _container.size();
+        }
+    };
+} // namespace xstl
+
+#endif
@@ -4,6 +4,7 @@
 #include <cassert>
 #include <utility>
 #include <iterator>
+#include <functional> //less
 
 namespace xstl
 {
@@ -24,41 +25,97 @@ namespace xstl
         using const_pointer = const value_type *;
         class iterator;
         class const_iterator;
+        class cursor;
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-    private:
-        node_type *_head = nullptr;
+    private: //ring link
+        //요소 node와 end() sentinel이 함께 쓰는 link입니다.
+        //sentinel도 ring 안에 있어서 splice/move/swap으로 요소가 옮겨가도 iterator는 자기 ring의 end()에 닿습니다.
+        struct _link
+        {
+            _link *prev;
+            _link *next;
+            bool is_end; //생성자가 있어 node_type의 value가 이 뒤의 padding에 놓일 수 있습니다.
+
+            explicit _link(bool end) : prev(this), next(this), is_end(end)
+            {
+            }
+        };
+
+        //처음 요소를 넣을 때 만들고, 소멸자에서만 반환합니다. move된 list는 nullptr을 가집니다.
+        _link *_end = nullptr;
         size_type _length = 0;
 
     public: //list node type
-        struct node_type
+        struct node_type : _link
         {
             using Self = node_type;
 
         public:
-            Self *prev;
             value_type value;
-            Self *next;
 
         public:
             node_type() = delete;
-            virtual ~node_type() = default;
-            node_type(Self *_prev, const_reference _value, Self *_next)
-                : prev(_prev), value(_value), next(_next)
+            ~node_type() = default;
+            explicit node_type(const_reference _value)
+                : _link(false), value(_value)
             {
             }
-            node_type(Self *_prev, value_type &&_value, Self *_next)
-                : prev(_prev), value(std::move(_value)), next(_next)
+            explicit node_type(value_type &&_value)
+                : _link(false), value(std::move(_value))
             {
             }
         };
 
+    private: //link helper
+        static node_type *_node(_link *link) noexcept
+        {
+            assert(link != nullptr && !link->is_end);
+            return static_cast<node_type *>(link);
+        }
+        static const node_type *_node(const _link *link) noexcept
+        {
+            assert(link != nullptr && !link->is_end);
+            return static_cast<const node_type *>(link);
+        }
+
+        _link *_end_link()
+        {
+            if (this->_end == nullptr)
+                this->_end = new _link(true);
+            return this->_end;
+        }
+        //end()는 sentinel이 아직 없으면 nullptr이므로 실제 sentinel로 바꿉니다.
+        _link *_position(const_iterator pos)
+        {
+            return pos.current == nullptr ? this->_end_link() : const_cast<_link *>(pos.current);
+        }
+
+        //position 앞에 node 하나를 겁니다.
+        void _link_before(_link *position, _link *node) noexcept
+        {
+            node->prev = position->prev;
+            node->next = position;
+            position->prev->next = node;
+            position->prev = node;
+            this->_length++;
+        }
+        //node 하나를 떼어내고 요소를 파괴합니다.
+        void _erase_node(_link *node) noexcept
+        {
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            delete _node(node);
+            this->_length--;
+        }
+
     public:
         circular_list() = default;
         ~circular_list()
         {
             this->clear();
+            delete this->_end;
         }
 
     public:
@@ -104,45 +161,48 @@ namespace xstl
         circular_list(const Self &other) : circular_list(other.begin(), other.end())
         {
         }
-        circular_list(Self &&other) : _head(other._head), _length(other._length)
+        //sentinel째로 가져오므로 other의 end()를 포함한 모든 iterator가 이 list를 가리키게 됩니다.
+        circular_list(Self &&other) : _end(other._end), _length(other._length)
         {
-            other._head = nullptr;
+            other._end = nullptr;
             other._length = 0;
         }
         Self &operator=(const Self &other)
         {
-            this->assign(other.begin(), other.end());
+            if (this != &other)
+                this->assign(other.begin(), other.end());
             return *this;
         }
         Self &operator=(Self &&other)
         {
-            this->_head = other._head;
-            this->_length = other._length;
-            other._head = nullptr;
-            other._length = 0;
+            if (this != &other)
+            {
+                this->clear();
+                this->swap(other);
+            }
             return *this;
         }
 
     public: //Element Access
         reference front()
         {
-            assert(this->_head != nullptr);
-            return this->_head->value;
+            assert(!this->empty());
+            return _node(this->_end->next)->value;
         }
         const_reference front() const
         {
-            assert(this->_head != nullptr);
-            return this->_head->value;
+            assert(!this->empty());
+            return _node(this->_end->next)->value;
         }
         reference back()
         {
-            assert(this->_head != nullptr);
-            return this->_head->prev->value;
+            assert(!this->empty());
+            return _node(this->_end->prev)->value;
         }
         const_reference back() const
         {
-            assert(this->_head != nullptr);
-            return this->_head->prev->value;
+            assert(!this->empty());
+            return _node(this->_end->prev)->value;
         }
 
     public: //Capacity
@@ -159,287 +219,151 @@ namespace xstl
         //Clear All Data
         void clear() noexcept
         {
-            if (!this->empty())
+            while (!this->empty())
                 this->pop_front();
         }
 
         //Swap
         void swap(Self &other) noexcept
         {
-            auto temp_head = this->_head;
+            auto temp_end = this->_end;
             auto temp_length = this->_length;
 
-            this->_head = other._head;
+            this->_end = other._end;
             this->_length = other._length;
 
-            other._head = temp_head;
+            other._end = temp_end;
             other._length = temp_length;
         }
 
     public: //front modifier
         void push_front(const_reference value)
         {
-            if (this->_head == nullptr)
-            {
-                this->_head = new node_type(nullptr, value, nullptr);
-                _head->prev = _head;
-                _head->next = _head;
-            }
-            else
-            {
-                this->_head = new node_type(this->_head->prev, value, this->_head);
-                _head->next->prev = _head;
-            }
-
-            _length++;
+            _link *end = this->_end_link();
+            this->_link_before(end->next, new node_type(value));
         }
         void push_front(value_type &&value)
         {
-            if (this->_head == nullptr)
-            {
-                this->_head = new node_type(nullptr, std::move(value), nullptr);
-                _head->prev = _head;
-                _head->next = _head;
-            }
-            else
-            {
-                this->_head = new node_type(this->_head->prev, value, this->_head);
-                _head->next->prev = _head;
-            }
-
-            _length++;
+            _link *end = this->_end_link();
+            this->_link_before(end->next, new node_type(std::move(value)));
         }
 
         void pop_front()
         {
-            assert(this->_head != nullptr);
-
-            if (this->_length == 1)
-            {
-                delete this->_head;
-                this->_head = nullptr;
-            }
-            else
-            {
-                auto original_head = this->_head;
-                this->_head = this->_head->next;
-                this->_head->prev = original_head->prev;
-                delete original_head;
-            }
-
-            this->_length--;
+            assert(!this->empty());
+            this->_erase_node(this->_end->next);
         }
 
         template <class... Args>
         void emplace_front(Args &&... args)
         {
-            if (this->_head == nullptr)
-            {
-                this->_head = new node_type(nullptr, value_type(std::forward<Args>(args)...), nullptr);
-                _head->prev = _head;
-                _head->next = _head;
-            }
-            else
-            {
-                this->_head = new node_type(this->_head->prev, value_type(std::forward<Args>(args)...), this->_head);
-                _head->next->prev = _head;
-            }
-
-            _length++;
+            _link *end = this->_end_link();
+            this->_link_before(end->next, new node_type(value_type(std::forward<Args>(args)...)));
         }
 
     public: // back modifier
         void push_back(const_reference value)
         {
-            if (this->_head == nullptr)
-            {
-                this->_head = new node_type(nullptr, value, nullptr);
-                _head->prev = _head;
-                _head->next = _head;
-            }
-            else
-            {
-                this->_head->prev = new node_type(this->_head->prev, value, this->_head);
-                this->_head->prev->prev->next = this->_head->prev;
-            }
-
-            _length++;
+            _link *end = this->_end_link();
+            this->_link_before(end, new node_type(value));
         }
         void push_back(value_type &&value)
         {
-            if (this->_head == nullptr)
-            {
-                this->_head = new node_type(nullptr, std::move(value), nullptr);
-                _head->prev = _head;
-                _head->next = _head;
-            }
-            else
-            {
-                this->_head->prev = new node_type(this->_head->prev, std::move(value), this->_head);
-                this->_head->prev->prev->next = this->_head->prev;
-            }
-
-            _length++;
+            _link *end = this->_end_link();
+            this->_link_before(end, new node_type(std::move(value)));
         }
 
         void pop_back()
         {
-            assert(this->_head != nullptr);
-
-            if (this->_length == 1)
-            {
-                delete this->_head;
-                this->_head = nullptr;
-            }
-            else
-            {
-                auto original_back = this->_head->prev;
-                this->_head->prev = original_back->prev;
-                original_back->prev->next = this->_head;
-                delete original_back;
-            }
-
-            this->_length--;
+            assert(!this->empty());
+            this->_erase_node(this->_end->prev);
         }
 
         template <class... Args>
         void emplace_back(Args &&... args)
         {
-            if (this->_head == nullptr)
-            {
-                this->_head = new node_type(nullptr, value_type(std::forward<Args>(args)...), nullptr);
-                _head->prev = _head;
-                _head->next = _head;
-            }
-            else
-            {
-                this->_head->prev = new node_type(this->_head->prev, value_type(std::forward<Args>(args)...), this->_head);
-                this->_head->prev->prev->next = this->_head->prev;
-            }
-
-            _length++;
+            _link *end = this->_end_link();
+            this->_link_before(end, new node_type(value_type(std::forward<Args>(args)...)));
         }
 
     public:
+        //pos 다음 자리에 넣습니다. pos가 end()면 맨 앞에 넣습니다.
         iterator insert(const_iterator pos, const_reference value)
         {
-            auto &before = const_cast<node_type *&>(pos.current);
-            auto &after = pos.current->next;
-            before->next = new node_type(before, value, after);
-            after->prev = before->next;
-
-            this->_length++;
+            _link *before = this->_position(pos);
+            this->_link_before(before->next, new node_type(value));
             return iterator(before->next);
         }
         iterator insert(const_iterator pos, value_type &&value)
         {
-            auto &before = const_cast<node_type *&>(pos.current);
-            auto &after = pos.current->next;
-            before->next = new node_type(before, std::move(value), after);
-            after->prev = before->next;
-
-            this->_length++;
+            _link *before = this->_position(pos);
+            this->_link_before(before->next, new node_type(std::move(value)));
             return iterator(before->next);
         }
 
         iterator insert(const_iterator pos, size_type count, const_reference value)
         {
-            auto position = pos;
+            _link *before = this->_position(pos);
+            auto position = const_iterator(before);
 
             for (int i = 0; i < count; i++)
             {
                 position = this->insert(position, value);
             }
 
-            return iterator(pos.current->next);
+            return iterator(before->next);
         }
 
         template <class InputIterator>
         iterator insert(const_iterator pos, InputIterator begin, InputIterator end)
         {
-            auto position = pos;
+            _link *before = this->_position(pos);
+            auto position = const_iterator(before);
 
             for (; begin != end; begin++)
             {
                 position = this->insert(position, *begin);
             }
 
-            return iterator(pos.current->next);
+            return iterator(before->next);
         }
         iterator insert(const_iterator pos, std::initializer_list<T> init)
         {
-            auto position = pos;
+            _link *before = this->_position(pos);
+            auto position = const_iterator(before);
 
             for (auto &e : init)
             {
                 position = this->insert(position, e);
             }
 
-            return iterator(pos.current->next);
+            return iterator(before->next);
         }
 
         template <class... Args>
         iterator emplace(const_iterator pos, Args &&... args)
         {
-            auto &before = const_cast<node_type *&>(pos.current);
-            auto &after = pos.current->next;
-            before->next = new node_type(before, value_type(std::forward<Args>(args)...), after);
-            after->prev = before->next;
-
-            this->_length++;
+            _link *before = this->_position(pos);
+            this->_link_before(before->next, new node_type(value_type(std::forward<Args>(args)...)));
             return iterator(before->next);
         }
 
         iterator erase(const_iterator pos)
         {
-            assert(this->_head != nullptr);
+            assert(!this->empty());
+            assert(pos.current != nullptr && !pos.current->is_end);
 
-            this->_length--;
-
-            if (this->_length == 1)
-            {
-                assert(this->_head == pos.current);
-                delete pos.current;
-                this->_head = nullptr;
-
-                return iterator(nullptr);
-            }
-            else
-            {
-                auto &before = pos.current->prev;
-                auto &after = pos.current->next;
-
-                if (this->_head == pos.current)
-                    this->_head = after;
-
-                before->next = after;
-                after->prev = before;
+            _link *after = pos.current->next;
+            this->_erase_node(const_cast<_link *>(pos.current));
 
-                delete pos.current;
-
-                return iterator(after);
-            }
+            return iterator(after);
         }
         iterator erase(const_iterator begin, const_iterator end)
         {
-            auto &before = const_cast<node_type *&>(begin.current->prev);
-            auto &after = const_cast<node_type *&>(end.current);
-
-            before->next = after;
-            after->prev = before;
-
-            if (this->_head == begin.current)
-                this->_head = after;
-
             while (begin != end)
-            {
-                auto temp = begin.current;
-                begin++;
-                delete temp;
-                this->_length--;
-            }
+                begin = this->erase(begin);
 
-            return iterator(after);
+            return iterator(const_cast<_link *>(end.current));
         }
 
         void resize(size_type count, const_reference new_value = value_type())
@@ -462,14 +386,265 @@ namespace xstl
             }
         }
 
+    private: //node relink helper
+        //[first, last] 구간 node들을 other에서 떼어냅니다. 노드는 해제하지 않습니다.
+        static void _unlink_range(Self &other, _link *first, _link *last, size_type count) noexcept
+        {
+            other._length -= count;
+
+            first->prev->next = last->next;
+            last->next->prev = first->prev;
+        }
+
+        //[first, last] 구간 node들을 position 앞에 연결합니다. position이 end()면 맨 뒤에 붙습니다.
+        void _link_range(_link *position, _link *first, _link *last, size_type count) noexcept
+        {
+            this->_length += count;
+
+            _link *before = position->prev;
+
+            before->next = first;
+            first->prev = before;
+            last->next = position;
+            position->prev = last;
+        }
+
+        //nullptr로 끝나는 두 정렬된 next 체인을 안정적으로 병합합니다.
+        template <class Compare>
+        static _link *_merge_chain(_link *left, _link *right, Compare &compare)
+        {
+            _link *merged = nullptr;
+            _link **tail = &merged;
+
+            while (left != nullptr && right != nullptr)
+            {
+                _link *&taken = compare(_node(right)->value, _node(left)->value) ? right : left;
+                *tail = taken;
+                tail = &taken->next;
+                taken = taken->next;
+            }
+            *tail = left != nullptr ? left : right;
+
+            return merged;
+        }
+
+        //sentinel만 남기고 요소들을 nullptr로 끝나는 next 체인으로 떼어냅니다.
+        _link *_detach_chain() noexcept
+        {
+            if (this->empty())
+                return nullptr;
+
+            _link *chain = this->_end->next;
+            this->_end->prev->next = nullptr;
+            this->_end->prev = this->_end;
+            this->_end->next = this->_end;
+
+            return chain;
+        }
+
+        //next 체인을 sentinel 뒤에 다시 잇고 prev 포인터를 복구합니다. sentinel은 이미 있어야 합니다.
+        void _attach_chain(_link *chain) noexcept
+        {
+            _link *node = this->_end;
+            for (; chain != nullptr; chain = chain->next)
+            {
+                chain->prev = node;
+                node->next = chain;
+                node = chain;
+            }
+
+            node->next = this->_end;
+            this->_end->prev = node;
+        }
+
+        //sentinel을 position 앞으로 옮겨 position이 front가 되게 합니다. O(1)
+        void _move_end_before(_link *position) noexcept
+        {
+            _link *end = this->_end;
+            if (position == end || position == end->next)
+                return;
+
+            end->prev->next = end->next;
+            end->next->prev = end->prev;
+
+            end->prev = position->prev;
+            end->next = position;
+            position->prev->next = end;
+            position->prev = end;
+        }
+
+    public: //list operations
+        //other의 모든 요소를 pos 앞으로 옮깁니다. O(1)
+        void splice(const_iterator pos, Self &other)
+        {
+            if (this == &other || other.empty())
+                return;
+
+            _link *position = this->_position(pos);
+            _link *first = other._end->next;
+            _link *last = other._end->prev;
+            size_type count = other._length;
+
+            _unlink_range(other, first, last, count);
+            this->_link_range(position, first, last, count);
+        }
+        void splice(const_iterator pos, Self &&other)
+        {
+            this->splice(pos, other);
+        }
+
+        //other의 it 요소 하나를 pos 앞으로 옮깁니다. O(1)
+        void splice(const_iterator pos, Self &other, const_iterator it)
+        {
+            _link *node = const_cast<_link *>(it.current);
+            assert(node != nullptr && !node->is_end);
+
+            _link *position = this->_position(pos);
+            if (position == node || position == node->next)
+                return;
+
+            _unlink_range(other, node, node, 1);
+            this->_link_range(position, node, node, 1);
+        }
+
+        //other의 [first, last) 구간을 pos 앞으로 옮깁니다. count는 구간 길이이며, O(1)
+        void splice(const_iterator pos, Self &other, const_iterator first, const_iterator last, size_type count)
+        {
+            if (count == 0)
+                return;
+
+            _link *position = this->_position(pos);
+            _link *first_node = const_cast<_link *>(first.current);
+            _link *last_node = last.current->prev;
+
+            _unlink_range(other, first_node, last_node, count);
+            this->_link_range(position, first_node, last_node, count);
+        }
+        //구간 길이를 세야 하므로 O(last - first)
+        void splice(const_iterator pos, Self &other, const_iterator first, const_iterator last)
+        {
+            this->splice(pos, other, first, last, std::distance(first, last));
+        }
+
+        //정렬된 other를 정렬된 이 list에 병합합니다. 값 복사 없이 node만 다시 잇습니다.
+        template <class Compare>
+        void merge(Self &other, Compare compare)
+        {
+            if (this == &other || other.empty())
+                return;
+
+            this->_end_link();
+            size_type count = this->_length + other._length;
+            _link *chain = _merge_chain(this->_detach_chain(), other._detach_chain(), compare);
+
+            this->_attach_chain(chain);
+            this->_length = count;
+            other._length = 0;
+        }
+        void merge(Self &other)
+        {
+            this->merge(other, std::less<value_type>());
+        }
+        template <class Compare>
+        void merge(Self &&other, Compare compare)
+        {
+            this->merge(other, compare);
+        }
+        void merge(Self &&other)
+        {
+            this->merge(other);
+        }
+
+        //bottom-up merge sort. node만 다시 이으며, 같은 값의 순서는 유지됩니다. O(n log n)
+        template <class Compare>
+        void sort(Compare compare)
+        {
+            if (this->_length < 2)
+                return;
+
+            //bins[i]는 길이 2^i의 정렬된 체인을 가집니다.
+            _link *bins[sizeof(size_type) * 8] = {};
+            size_type bin_count = 0;
+
+            _link *chain = this->_detach_chain();
+            while (chain != nullptr)
+            {
+                _link *carry = chain;
+                chain = chain->next;
+                carry->next = nullptr;
+
+                size_type i = 0;
+                for (; i < bin_count && bins[i] != nullptr; i++)
+                {
+                    carry = _merge_chain(bins[i], carry, compare);
+                    bins[i] = nullptr;
+                }
+                bins[i] = carry;
+                if (i == bin_count)
+                    bin_count++;
+            }
+
+            _link *sorted = nullptr;
+            for (size_type i = 0; i < bin_count; i++)
+                sorted = _merge_chain(bins[i], sorted, compare);
+
+            this->_attach_chain(sorted);
+        }
+        void sort()
+        {
+            this->sort(std::less<value_type>());
+        }
+
+    public: //ring operations
+        //front가 n번째 요소가 되도록 ring을 돌립니다. n이 음수면 반대로 돌립니다. O(min(n, size - n))
+        void rotate(difference_type n)
+        {
+            if (this->_length < 2)
+                return;
+
+            difference_type length = static_cast<difference_type>(this->_length);
+            n %= length;
+            if (n < 0)
+                n += length;
+
+            //새 front를 찾아 그 앞으로 sentinel만 옮깁니다.
+            _link *front = this->_end->next;
+            if (n <= length / 2)
+                for (; n > 0; n--)
+                    front = front->next;
+            else
+                for (front = this->_end->prev, n = length - n - 1; n > 0; n--)
+                    front = front->prev;
+
+            this->_move_end_before(front);
+        }
+
+        //pos가 front가 되도록 ring을 돌립니다. O(1)
+        void rotate_to(const_iterator pos)
+        {
+            assert(pos.current != nullptr && !pos.current->is_end);
+            this->_move_end_before(const_cast<_link *>(pos.current));
+        }
+
+        //head가 아닌 현재 위치를 기억하며 ring을 끝없이 도는 cursor를 만듭니다.
+        cursor make_cursor()
+        {
+            return cursor(this->empty() ? nullptr : this->_end->next);
+        }
+        cursor make_cursor(const_iterator pos)
+        {
+            assert(pos.current != nullptr && !pos.current->is_end);
+            return cursor(const_cast<_link *>(pos.current));
+        }
+
     public: //iterator
         iterator begin()
         {
-            return iterator(this->_head);
+            return iterator(this->_end == nullptr ? nullptr : this->_end->next);
         }
         iterator end()
         {
-            return iterator(nullptr);
+            return iterator(this->_end);
         }
         const_iterator begin() const
         {
@@ -481,44 +656,45 @@ namespace xstl
         }
         const_iterator cbegin() const
         {
-            return const_iterator(this->_head);
+            return const_iterator(this->_end == nullptr ? nullptr : this->_end->next);
         }
         const_iterator cend() const
         {
-            return const_iterator(nullptr);
+            return const_iterator(this->_end);
         }
 
     public: //reverse iterator
         reverse_iterator rbegin()
         {
-            return reverse_iterator(this->_head);
+            return reverse_iterator(this->end());
         }
         reverse_iterator rend()
         {
-            return reverse_iterator(nullptr);
+            return reverse_iterator(this->begin());
         }
         const_reverse_iterator rbegin() const
         {
-            return this->cbegin();
+            return this->crbegin();
         }
         const_reverse_iterator rend() const
         {
-            return this->cend();
+            return this->crend();
         }
         const_reverse_iterator crbegin() const
         {
-            return const_reverse_iterator(this->_head);
+            return const_reverse_iterator(this->cend());
         }
         const_reverse_iterator crend() const
         {
-            return const_reverse_iterator(nullptr);
+            return const_reverse_iterator(this->cbegin());
         }
 
     public:
+        //마지막 요소 다음은 ring 안의 sentinel, 즉 end()입니다. list 객체를 보지 않으므로 요소와 함께 옮겨 다닙니다.
         class iterator
         {
         private:
-            node_type *current;
+            _link *current;
 
         public:
             using Self = iterator;
@@ -526,9 +702,9 @@ namespace xstl
             friend circular_list;
 
         public:
-            using value_type = value_type;
-            using pointer = pointer;
-            using reference = reference;
+            using value_type = circular_list::value_type;
+            using pointer = circular_list::pointer;
+            using reference = circular_list::reference;
             using difference_type = std::ptrdiff_t;
             using iterator_category = std::bidirectional_iterator_tag;
 
@@ -542,57 +718,149 @@ namespace xstl
             Self &operator=(const Self &) = default;
             Self &operator=(Self &&) = default;
 
-        public:
-            iterator(node_type *p) : current(p)
+        private:
+            explicit iterator(_link *p) : current(p)
             {
             }
 
         public: //move operator
             Self &operator++()
             {
-                assert(current != nullptr);
+                assert(current != nullptr && !current->is_end);
                 current = current->next;
                 return *this;
             }
             Self operator++(int)
+            {
+                Self temp = *this;
+                ++*this;
+                return temp;
+            }
+            Self &operator--()
+            {
+                assert(current != nullptr && !current->prev->is_end);
+                current = current->prev;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                --*this;
+                return temp;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                return _node(current)->value;
+            }
+            pointer operator->() const
+            {
+                return &_node(current)->value;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+
+        //end()가 없는 ring 위치입니다. sentinel은 건너뛰며, 가리키는 요소가 지워지기 전까지 유효합니다.
+        class cursor
+        {
+        private:
+            _link *current;
+
+        public:
+            using Self = cursor;
+            friend circular_list;
+
+        public:
+            cursor() = delete;
+            ~cursor() = default;
+
+        public: //move & copy member
+            cursor(const Self &) = default;
+            cursor(Self &&) = default;
+            Self &operator=(const Self &) = default;
+            Self &operator=(Self &&) = default;
+
+        private:
+            explicit cursor(_link *p) : current(p)
+            {
+            }
+
+        public:
+            bool valid() const noexcept
+            {
+                return current != nullptr;
+            }
+
+        public: //move operator
+            Self &operator++()
             {
                 assert(current != nullptr);
                 current = current->next;
+                if (current->is_end)
+                    current = current->next;
                 return *this;
             }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                ++*this;
+                return temp;
+            }
             Self &operator--()
             {
                 assert(current != nullptr);
                 current = current->prev;
+                if (current->is_end)
+                    current = current->prev;
                 return *this;
             }
             Self operator--(int)
             {
-                assert(current != nullptr);
-                current = current->prev;
-                return *this;
+                Self temp = *this;
+                --*this;
+                return temp;
             }
 
         public: //access operator
-            reference operator*()
+            reference operator*() const
             {
-                assert(current != nullptr);
-                return current->value;
+                return _node(current)->value;
             }
-            const_reference operator*() const
+            pointer operator->() const
             {
-                assert(current != nullptr);
-                return current->value;
+                return &_node(current)->value;
             }
-            pointer operator->()
+
+        public: //round-robin helper
+            //현재 요소를 돌려주고 다음 요소로 넘어갑니다. O(1)
+            reference next()
             {
                 assert(current != nullptr);
-                return &current->value;
+                node_type *picked = _node(current);
+                ++*this;
+                return picked->value;
             }
-            const_pointer operator->() const
+
+            //현재 위치부터 count개 요소를 out에 복사하고 그만큼 넘어갑니다. ring을 여러 바퀴 돌 수 있습니다.
+            template <class OutputIterator>
+            OutputIterator fetch(size_type count, OutputIterator out)
             {
-                assert(current != nullptr);
-                return &current->value;
+                for (; count > 0; count--)
+                {
+                    *out = this->next();
+                    ++out;
+                }
+                return out;
             }
 
         public: //comparer
@@ -609,16 +877,16 @@ namespace xstl
         class const_iterator
         {
         private:
-            const node_type *current;
+            const _link *current;
 
         public:
             using Self = const_iterator;
             friend circular_list;
 
         public:
-            using value_type = value_type;
-            using pointer = pointer;
-            using reference = reference;
+            using value_type = circular_list::value_type;
+            using pointer = circular_list::const_pointer;
+            using reference = circular_list::const_reference;
             using difference_type = std::ptrdiff_t;
             using iterator_category = std::bidirectional_iterator_tag;
 
@@ -632,10 +900,12 @@ namespace xstl
             Self &operator=(const Self &) = default;
             Self &operator=(Self &&) = default;
 
-        public:
-            const_iterator(node_type *p) : current(p)
+        private:
+            explicit const_iterator(const _link *p) : current(p)
             {
             }
+
+        public:
             const_iterator(const iterator &mutable_iterator) : current(mutable_iterator.current)
             {
             }
@@ -643,39 +913,37 @@ namespace xstl
         public: //move operator
             Self &operator++()
             {
-                assert(current != nullptr);
+                assert(current != nullptr && !current->is_end);
                 current = current->next;
                 return *this;
             }
             Self operator++(int)
             {
-                assert(current != nullptr);
-                current = current->next;
-                return *this;
+                Self temp = *this;
+                ++*this;
+                return temp;
             }
             Self &operator--()
             {
-                assert(current != nullptr);
+                assert(current != nullptr && !current->prev->is_end);
                 current = current->prev;
                 return *this;
             }
             Self operator--(int)
             {
-                assert(current != nullptr);
-                current = current->prev;
-                return *this;
+                Self temp = *this;
+                --*this;
+                return temp;
             }
 
         public: //access operator
             const_reference operator*() const
             {
-                assert(current != nullptr);
-                return current->value;
+                return _node(current)->value;
             }
             const_pointer operator->() const
             {
-                assert(current != nullptr);
-                return &current->value;
+                return &_node(current)->value;
             }
 
         public: //comparer
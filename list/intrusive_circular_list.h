@@ -0,0 +1,525 @@
+#ifndef __XSTL_INTRUSIVE_CIRCULAR_LIST__
+#define __XSTL_INTRUSIVE_CIRCULAR_LIST__
+
+/*
+    Intrusive Circular List.
+    Elements embed a circular_list_hook and are linked in place, without allocation.
+    One object can sit on several rings at once by having one hook per ring.
+    The list never owns its elements.
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring> //memcpy
+#include <type_traits>
+#include <utility>
+#include <iterator>
+
+namespace xstl
+{
+    //intrusive_circular_list에 연결되기 위한 member hook입니다.
+    struct circular_list_hook
+    {
+        using Self = circular_list_hook;
+
+    public:
+        Self *prev = nullptr;
+        Self *next = nullptr;
+
+    public:
+        circular_list_hook() = default;
+        //파괴되는 객체는 스스로 ring에서 빠집니다.
+        ~circular_list_hook()
+        {
+            this->unlink();
+        }
+
+    public: //복사/이동해도 연결 상태는 옮기지 않습니다.
+        circular_list_hook(const Self &)
+        {
+        }
+        Self &operator=(const Self &)
+        {
+            return *this;
+        }
+
+    public:
+        bool is_linked() const noexcept
+        {
+            return this->next != nullptr;
+        }
+
+        //어느 ring에 있든 O(1)로 빠집니다.
+        void unlink() noexcept
+        {
+            if (!this->is_linked())
+                return;
+
+            this->prev->next = this->next;
+            this->next->prev = this->prev;
+            this->prev = nullptr;
+            this->next = nullptr;
+        }
+    };
+
+    template <class T, circular_list_hook T::*Hook>
+    class intrusive_circular_list
+    {
+    public:
+        using Self = intrusive_circular_list;
+
+    public: //stl standard type member
+        using value_type = T;
+        using hook_type = circular_list_hook;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        class iterator;
+        class const_iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    private:
+        //ring의 시작과 끝을 표시하는 sentinel입니다. 비어 있으면 자기 자신을 가리킵니다.
+        hook_type _root;
+
+    private: //hook <-> element 변환
+        //element 시작에서 hook까지의 거리입니다. 주요 ABI(Itanium, MSVC)에서 data member pointer는 그 거리 자체로 표현되므로
+        //표현을 그대로 읽습니다. Hook은 template 인자라서 최적화되면 상수로 접힙니다. (Boost.Intrusive와 같은 방법)
+        static std::ptrdiff_t _hook_offset() noexcept
+        {
+            using offset_type = typename std::conditional<sizeof(Hook) == sizeof(std::int32_t), std::int32_t, std::int64_t>::type;
+            static_assert(sizeof(Hook) == sizeof(offset_type), "unsupported member pointer representation");
+
+            hook_type value_type::*member = Hook;
+            offset_type offset;
+            std::memcpy(&offset, &member, sizeof(offset));
+            return static_cast<std::ptrdiff_t>(offset);
+        }
+        static pointer _owner(hook_type *hook)
+        {
+            return reinterpret_cast<pointer>(reinterpret_cast<char *>(hook) - _hook_offset());
+        }
+        static const_pointer _owner(const hook_type *hook)
+        {
+            return reinterpret_cast<const_pointer>(reinterpret_cast<const char *>(hook) - _hook_offset());
+        }
+        static hook_type *_hook(reference value)
+        {
+            hook_type *hook = &(value.*Hook);
+            assert(_owner(hook) == &value);
+            return hook;
+        }
+
+        //node를 position 앞에 연결합니다.
+        static void _link_before(hook_type *position, hook_type *node)
+        {
+            assert(!node->is_linked());
+
+            node->next = position;
+            node->prev = position->prev;
+            position->prev->next = node;
+            position->prev = node;
+        }
+
+        //다른 list의 root를 가리키던 양끝 node를 이 list의 root로 옮깁니다.
+        void _take_links(hook_type &other_root)
+        {
+            if (other_root.next == &other_root)
+            {
+                this->_root.prev = this->_root.next = &this->_root;
+                return;
+            }
+
+            this->_root.next = other_root.next;
+            this->_root.prev = other_root.prev;
+            this->_root.next->prev = &this->_root;
+            this->_root.prev->next = &this->_root;
+            other_root.prev = other_root.next = &other_root;
+        }
+
+    public:
+        intrusive_circular_list()
+        {
+            this->_root.prev = this->_root.next = &this->_root;
+        }
+        ~intrusive_circular_list()
+        {
+            this->clear();
+            this->_root.prev = this->_root.next = nullptr;
+        }
+
+    public:
+        template <class InputIterator>
+        intrusive_circular_list(InputIterator begin, InputIterator end) : intrusive_circular_list()
+        {
+            for (; begin != end; ++begin)
+                this->push_back(*begin);
+        }
+
+    public: // copy&move member
+        //요소를 소유하지 않으므로 복사는 허용하지 않습니다.
+        intrusive_circular_list(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+        intrusive_circular_list(Self &&other)
+        {
+            this->_take_links(other._root);
+        }
+        Self &operator=(Self &&other)
+        {
+            if (this != &other)
+            {
+                this->clear();
+                this->_take_links(other._root);
+            }
+            return *this;
+        }
+
+    public: //Element Access
+        reference front()
+        {
+            assert(!this->empty());
+            return *_owner(this->_root.next);
+        }
+        const_reference front() const
+        {
+            assert(!this->empty());
+            return *_owner(this->_root.next);
+        }
+        reference back()
+        {
+            assert(!this->empty());
+            return *_owner(this->_root.prev);
+        }
+        const_reference back() const
+        {
+            assert(!this->empty());
+            return *_owner(this->_root.prev);
+        }
+
+    public: //Capacity
+        bool empty() const noexcept
+        {
+            return this->_root.next == &this->_root;
+        }
+        //hook::unlink()로 언제든 빠질 수 있으므로 길이를 따로 세지 않습니다. O(n)
+        size_type size() const noexcept
+        {
+            size_type count = 0;
+            for (auto node = this->_root.next; node != &this->_root; node = node->next)
+                count++;
+            return count;
+        }
+
+    public:
+        //Unlink All Elements
+        void clear() noexcept
+        {
+            while (!this->empty())
+                this->_root.next->unlink();
+        }
+
+        //Swap
+        void swap(Self &other) noexcept
+        {
+            Self temp(std::move(other));
+            other._take_links(this->_root);
+            this->_take_links(temp._root);
+        }
+
+    public: //front modifier
+        void push_front(reference value)
+        {
+            _link_before(this->_root.next, _hook(value));
+        }
+        void pop_front()
+        {
+            assert(!this->empty());
+            this->_root.next->unlink();
+        }
+
+    public: // back modifier
+        void push_back(reference value)
+        {
+            _link_before(&this->_root, _hook(value));
+        }
+        void pop_back()
+        {
+            assert(!this->empty());
+            this->_root.prev->unlink();
+        }
+
+    public:
+        //pos 앞에 value를 연결합니다.
+        iterator insert(const_iterator pos, reference value)
+        {
+            _link_before(const_cast<hook_type *>(pos.current), _hook(value));
+            return iterator(_hook(value));
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            assert(pos.current != &this->_root);
+
+            auto node = const_cast<hook_type *>(pos.current);
+            auto next = node->next;
+            node->unlink();
+            return iterator(next);
+        }
+        iterator erase(const_iterator begin, const_iterator end)
+        {
+            while (begin != end)
+                begin = this->erase(begin);
+            return iterator(const_cast<hook_type *>(end.current));
+        }
+
+        //value가 이 list에 연결되어 있어야 합니다. O(1)
+        void erase(reference value)
+        {
+            _hook(value)->unlink();
+        }
+
+        //other의 모든 요소를 pos 앞으로 옮깁니다. O(1)
+        void splice(const_iterator pos, Self &other)
+        {
+            if (this == &other || other.empty())
+                return;
+
+            auto position = const_cast<hook_type *>(pos.current);
+            auto first = other._root.next;
+            auto last = other._root.prev;
+            other._root.prev = other._root.next = &other._root;
+
+            first->prev = position->prev;
+            last->next = position;
+            position->prev->next = first;
+            position->prev = last;
+        }
+
+        //value를 가리키는 iterator를 만듭니다. O(1)
+        static iterator iterator_to(reference value)
+        {
+            return iterator(_hook(value));
+        }
+        static const_iterator iterator_to(const_reference value)
+        {
+            return const_iterator(&(value.*Hook));
+        }
+
+    public: //iterator
+        iterator begin()
+        {
+            return iterator(this->_root.next);
+        }
+        iterator end()
+        {
+            return iterator(&this->_root);
+        }
+        const_iterator begin() const
+        {
+            return this->cbegin();
+        }
+        const_iterator end() const
+        {
+            return this->cend();
+        }
+        const_iterator cbegin() const
+        {
+            return const_iterator(this->_root.next);
+        }
+        const_iterator cend() const
+        {
+            return const_iterator(&this->_root);
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(this->end());
+        }
+        reverse_iterator rend()
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rbegin() const
+        {
+            return this->crbegin();
+        }
+        const_reverse_iterator rend() const
+        {
+            return this->crend();
+        }
+        const_reverse_iterator crbegin() const
+        {
+            return const_reverse_iterator(this->cend());
+        }
+        const_reverse_iterator crend() const
+        {
+            return const_reverse_iterator(this->cbegin());
+        }
+
+    public:
+        class iterator
+        {
+        private:
+            hook_type *current;
+
+        public:
+            using Self = iterator;
+            friend const_iterator;
+            friend intrusive_circular_list;
+
+        public:
+            using value_type = intrusive_circular_list::value_type;
+            using pointer = intrusive_circular_list::pointer;
+            using reference = intrusive_circular_list::reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            iterator() = delete;
+            ~iterator() = default;
+
+        public: //move & copy member
+            iterator(const Self &) = default;
+            iterator(Self &&) = default;
+            Self &operator=(const Self &) = default;
+            Self &operator=(Self &&) = default;
+
+        public:
+            explicit iterator(hook_type *p) : current(p)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                current = current->next;
+                return temp;
+            }
+            Self &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                current = current->prev;
+                return temp;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                return *_owner(current);
+            }
+            pointer operator->() const
+            {
+                return _owner(current);
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+
+        class const_iterator
+        {
+        private:
+            const hook_type *current;
+
+        public:
+            using Self = const_iterator;
+            friend intrusive_circular_list;
+
+        public:
+            using value_type = intrusive_circular_list::value_type;
+            using pointer = intrusive_circular_list::const_pointer;
+            using reference = intrusive_circular_list::const_reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            const_iterator() = delete;
+            ~const_iterator() = default;
+
+        public: //move & copy member
+            const_iterator(const Self &) = default;
+            const_iterator(Self &&) = default;
+            Self &operator=(const Self &) = default;
+            Self &operator=(Self &&) = default;
+
+        public:
+            explicit const_iterator(const hook_type *p) : current(p)
+            {
+            }
+            const_iterator(const iterator &mutable_iterator) : current(mutable_iterator.current)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                current = current->next;
+                return temp;
+            }
+            Self &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                current = current->prev;
+                return temp;
+            }
+
+        public: //access operator
+            const_reference operator*() const
+            {
+                return *_owner(current);
+            }
+            const_pointer operator->() const
+            {
+                return _owner(current);
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+    };
+} // namespace xstl
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef __XSTL_MPMC_RING__
+#define __XSTL_MPMC_RING__
+
+/*
+    Bounded Multi-Producer Multi-Consumer Ring Buffer (Vyukov).
+    Each cell carries a sequence number that says whose turn it is, so producers and consumers
+    only contend on one CAS of their own index. Capacity is rounded up to a power of two.
+
+    The element constructor must not throw once a cell has been claimed (emplace/push),
+    otherwise that cell is never published and the ring stalls.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../array/fixed_vector.h"
+#include "../utility/atomic_wait.h"
+
+namespace xstl
+{
+    template <class T>
+    class mpmc_ring
+    {
+    public:
+        using Self = mpmc_ring;
+
+    public: //stl standard type member
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+
+    private:
+        //sequence == position이면 producer 차례, position + 1이면 consumer 차례입니다.
+        struct _cell
+        {
+            std::atomic<size_type> sequence;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+            T *value() noexcept
+            {
+                return reinterpret_cast<T *>(&this->storage);
+            }
+        };
+
+        fixed_vector<_cell, aligned_allocation<64>> _cells;
+        size_type _mask = 0;
+
+        alignas(64) std::atomic<size_type> _enqueue{0};
+        alignas(64) std::atomic<size_type> _dequeue{0};
+        alignas(64) _wait_channel _not_empty;
+        _wait_channel _not_full;
+
+    private:
+        _cell &_cell_at(size_type position) noexcept
+        {
+            return this->_cells[position & this->_mask];
+        }
+        static std::intptr_t _distance(size_type sequence, size_type position) noexcept
+        {
+            return static_cast<std::intptr_t>(sequence - position);
+        }
+
+        //position부터 최대 wanted개의 연속된 칸을 index로 얻습니다. 얻은 칸 수를 돌려줍니다.
+        //ready_offset은 producer면 0, consumer면 1입니다.
+        size_type _claim(std::atomic<size_type> &index, size_type ready_offset, size_type wanted, size_type &position)
+        {
+            position = index.load(std::memory_order_relaxed);
+            while (true)
+            {
+                size_type n = 0;
+                while (n < wanted && this->_cell_at(position + n).sequence.load(std::memory_order_acquire) == position + n + ready_offset)
+                    n++;
+
+                if (n == 0)
+                {
+                    std::intptr_t distance = _distance(this->_cell_at(position).sequence.load(std::memory_order_acquire), position + ready_offset);
+                    if (distance < 0)
+                        return 0; //producer면 가득, consumer면 비어 있음
+                    position = index.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                //CAS가 성공했다면 그 사이 아무도 이 칸들을 가져가지 않은 것입니다.
+                if (index.compare_exchange_weak(position, position + n, std::memory_order_relaxed))
+                    return n;
+            }
+        }
+
+    public:
+        //capacity는 2의 거듭제곱으로 올림합니다. (최소 2)
+        explicit mpmc_ring(size_type capacity)
+        {
+            size_type rounded = 2;
+            while (rounded < capacity)
+                rounded *= 2;
+
+            this->_cells = fixed_vector<_cell, aligned_allocation<64>>(rounded, for_overwrite);
+            this->_mask = rounded - 1;
+            for (size_type i = 0; i < rounded; i++)
+                this->_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        ~mpmc_ring()
+        {
+            size_type end = this->_enqueue.load(std::memory_order_relaxed);
+            for (size_type position = this->_dequeue.load(std::memory_order_relaxed); position != end; position++)
+                this->_cell_at(position).value()->~T();
+        }
+
+    public: //not copyable, not movable
+        mpmc_ring(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public: //producer
+        template <class... Args>
+        bool try_emplace(Args &&... args)
+        {
+            size_type position;
+            if (this->_claim(this->_enqueue, 0, 1, position) == 0)
+                return false;
+
+            _cell &cell = this->_cell_at(position);
+            ::new (static_cast<void *>(cell.value())) T(std::forward<Args>(args)...);
+            cell.sequence.store(position + 1, std::memory_order_release);
+            this->_not_empty.notify();
+            return true;
+        }
+        bool try_push(const value_type &value)
+        {
+            return this->try_emplace(value);
+        }
+        bool try_push(value_type &&value)
+        {
+            return this->try_emplace(std::move(value));
+        }
+
+        //연속된 칸을 한 번의 CAS로 잡아 최대 count개를 넣습니다. 넣은 개수를 돌려줍니다.
+        template <class InputIterator>
+        size_type try_push_bulk(InputIterator first, size_type count)
+        {
+            size_type position;
+            size_type n = count == 0 ? 0 : this->_claim(this->_enqueue, 0, count, position);
+            for (size_type i = 0; i < n; i++, ++first)
+            {
+                _cell &cell = this->_cell_at(position + i);
+                ::new (static_cast<void *>(cell.value())) T(*first);
+                cell.sequence.store(position + i + 1, std::memory_order_release);
+            }
+            if (n != 0)
+                this->_not_empty.notify();
+            return n;
+        }
+
+        void push(const value_type &value)
+        {
+            this->_not_full.wait_until([&] { return this->try_emplace(value); });
+        }
+        void push(value_type &&value)
+        {
+            this->_not_full.wait_until([&] { return this->try_emplace(std::move(value)); });
+        }
+        template <class InputIterator>
+        void push_bulk(InputIterator first, size_type count)
+        {
+            while (count > 0)
+            {
+                size_type pushed = 0;
+                this->_not_full.wait_until([&] { return (pushed = this->try_push_bulk(first, count)) != 0; });
+                std::advance(first, pushed);
+                count -= pushed;
+            }
+        }
+
+    public: //consumer
+        bool try_pop(value_type &out)
+        {
+            size_type position;
+            if (this->_claim(this->_dequeue, 1, 1, position) == 0)
+                return false;
+
+            _cell &cell = this->_cell_at(position);
+            out = std::move(*cell.value());
+            cell.value()->~T();
+            cell.sequence.store(position + this->_mask + 1, std::memory_order_release);
+            this->_not_full.notify();
+            return true;
+        }
+
+        template <class OutputIterator>
+        size_type try_pop_bulk(OutputIterator out, size_type max)
+        {
+            size_type position;
+            size_type n = max == 0 ? 0 : this->_claim(this->_dequeue, 1, max, position);
+            for (size_type i = 0; i < n; i++, ++out)
+            {
+                _cell &cell = this->_cell_at(position + i);
+                *out = std::move(*cell.value());
+                cell.value()->~T();
+                cell.sequence.store(position + i + this->_mask + 1, std::memory_order_release);
+            }
+            if (n != 0)
+                this->_not_full.notify();
+            return n;
+        }
+
+        void pop(value_type &out)
+        {
+            this->_not_empty.wait_until([&] { return this->try_pop(out); });
+        }
+        template <class OutputIterator>
+        size_type pop_bulk(OutputIterator out, size_type max)
+        {
+            size_type popped = 0;
+            if (max != 0)
+                this->_not_empty.wait_until([&] { return (popped = this->try_pop_bulk(out, max)) != 0; });
+            return popped;
+        }
+
+    public: //capacity
+        //다른 thread가 동작 중이면 근사값입니다.
+        size_type size() const noexcept
+        {
+            size_type dequeue = this->_dequeue.load(std::memory_order_acquire);
+            size_type enqueue = this->_enqueue.load(std::memory_order_acquire);
+            return enqueue > dequeue ? enqueue - dequeue : 0;
+        }
+        bool empty() const noexcept
+        {
+            return this->size() == 0;
+        }
+        size_type capacity() const noexcept
+        {
+            return this->_mask + 1;
+        }
+    };
+} // namespace xstl
+
+#endif
@@ -1,139 +1,455 @@
+#ifndef __XSTL_SKIP_LIST__
+#define __XSTL_SKIP_LIST__
+
+/*
+    Ordered Skip List (multiset).
+    A node is a single allocation: its forward links sit right before the node header and the value follows it,
+    so a node of height h pays for exactly h links. Heights come from a seeded xorshift generator (p = 1/4),
+    so the same seed and the same insertion order always build the same list.
+    Every link also stores its span (how many level 0 steps it skips), which gives positional access
+    (nth, at, rank, erase_at) in O(log n) like the Redis zset.
+*/
+
 #include <cassert>
-#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <functional> //less
+#include <initializer_list>
 #include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../array/allocation_policy.h"
 
 namespace xstl
 {
-    template <class T>
+    template <class T, class Compare = std::less<T>>
     class skip_list
     {
     public:
         using Self = skip_list;
 
     public: //stl standard type member
+        using key_type = T;
         using value_type = T;
-        struct node_type;
         using size_type = std::size_t;
         using difference_type = std::ptrdiff_t;
-        using reference = value_type&;
-        using const_reference = const value_type&;
-        using pointer = value_type*;
-        using const_pointer = const value_type*;
-        class iterator;
+        using key_compare = Compare;
+        using value_compare = Compare;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
         class const_iterator;
+        using iterator = const_iterator; //값이 곧 정렬 기준이므로 std::set처럼 값을 고칠 수 없습니다.
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        class finger;
+        class range_type;
+
+    public:
+        static constexpr size_type max_level = 32;
+        static constexpr std::uint64_t default_seed = 0x9e3779b97f4a7c15ull;
+
     private:
-        node_type* _head = nullptr;
-        size_type _length = 0;
+        struct _node_base;
+        //span은 next까지 level 0에서 몇 칸인지입니다. next가 없으면 끝(size() + 1번째)까지로 셉니다.
+        struct _link
+        {
+            _node_base *next;
+            size_type span;
+        };
 
-    public: //list node type
-        struct node_type
+        //level i의 link는 header 바로 앞에서부터 거꾸로 놓입니다. (link(0)이 header에 가장 가깝습니다)
+        struct _node_base
+        {
+            _node_base *prev = nullptr; //level 0의 이전 node, 첫 node면 nullptr
+            size_type level = 0;
+
+            _node_base() = default;
+            explicit _node_base(size_type _level) : level(_level)
+            {
+            }
+
+            _link &link(size_type i) noexcept
+            {
+                return reinterpret_cast<_link *>(this)[-1 - static_cast<std::ptrdiff_t>(i)];
+            }
+            const _link &link(size_type i) const noexcept
+            {
+                return reinterpret_cast<const _link *>(this)[-1 - static_cast<std::ptrdiff_t>(i)];
+            }
+            _node_base *&next(size_type i) noexcept
+            {
+                return this->link(i).next;
+            }
+            _node_base *next(size_type i) const noexcept
+            {
+                return this->link(i).next;
+            }
+            size_type &span(size_type i) noexcept
+            {
+                return this->link(i).span;
+            }
+        };
+        struct _node : _node_base
         {
-            using Self = node_type;
-        public:
-            Self* prev;
             value_type value;
-            Self* next;
-        public:
-            node_type() = delete;
-            virtual ~node_type() = default;
-            node_type(Self* _prev, const_reference _value, Self* _next)
-                : prev(_prev), value(_value), next(_next)
-            {}
-            node_type(Self* _prev, value_type&& _value, Self* _next)
-                : prev(_prev), value(std::move(_value)), next(_next)
-            {}
+
+            template <class... Args>
+            explicit _node(size_type _level, Args &&... args) : _node_base(_level), value(std::forward<Args>(args)...)
+            {
+            }
+        };
+        //head는 값이 없는 최대 높이 node입니다. node와 같은 방식으로 link가 header 앞에 붙어 있습니다.
+        struct _head_type
+        {
+            _link links[max_level];
+            _node_base base;
         };
 
-    public:
-        skip_list() = default;
-        ~skip_list()
+        _head_type _head;
+        _node_base *_tail = nullptr;
+        size_type _level = 1; //head에서 검색을 시작할 높이
+        size_type _length = 0;
+        size_type _version = 0; //finger가 아직 유효한지 확인하는 용도
+        std::uint64_t _random = default_seed;
+        Compare _compare;
+
+    private: //node
+        static size_type _links_bytes(size_type level) noexcept
         {
-            this->clear();
+            size_type bytes = level * sizeof(_link);
+            return (bytes + alignof(_node) - 1) / alignof(_node) * alignof(_node);
+        }
+        template <class... Args>
+        static _node_base *_create_node(size_type level, Args &&... args)
+        {
+            //link 영역이 alignof(_node)의 배수이므로 시작을 맞추면 node도 맞춰집니다.
+            size_type front = _links_bytes(level);
+            char *memory = static_cast<char *>(default_allocation::allocate(front + sizeof(_node), alignof(_node)));
+            try
+            {
+                return ::new (static_cast<void *>(memory + front)) _node(level, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                default_allocation::deallocate(memory, front + sizeof(_node), alignof(_node));
+                throw;
+            }
+        }
+        static void _destroy_node(_node_base *node) noexcept
+        {
+            size_type front = _links_bytes(node->level);
+            char *memory = reinterpret_cast<char *>(node) - front;
+            static_cast<_node *>(node)->~_node();
+            default_allocation::deallocate(memory, front + sizeof(_node), alignof(_node));
+        }
+        static const value_type &_value(const _node_base *node) noexcept
+        {
+            return static_cast<const _node *>(node)->value;
         }
 
-    public:
-        skip_list(size_type count, const_reference value = value_type())
+        _node_base *_head_node() const noexcept
+        {
+            return const_cast<_node_base *>(&this->_head.base);
+        }
+        void _reset_head() noexcept
+        {
+            for (auto &link : this->_head.links)
+                link = _link{nullptr, 1};
+            this->_head.base.prev = nullptr;
+            this->_head.base.level = max_level;
+            this->_tail = nullptr;
+            this->_level = 1;
+            this->_length = 0;
+            this->_version++;
+        }
+
+        //xorshift64*의 상위 bit를 2개씩 보며 1/4 확률로 한 층씩 올립니다.
+        size_type _random_level() noexcept
+        {
+            std::uint64_t x = this->_random;
+            x ^= x >> 12;
+            x ^= x << 25;
+            x ^= x >> 27;
+            this->_random = x;
+            std::uint64_t bits = x * 0x2545f4914f6cdd1dull;
+
+            size_type level = 1;
+            while (level < max_level && (bits & 3) == 0)
+            {
+                level++;
+                bits >>= 2;
+            }
+            return level;
+        }
+
+    private: //search
+        //before(node, node의 순위)가 참인 마지막 node를 층마다 path에, 그 순위를 ranks에 남기고 level 0의 것을 돌려줍니다.
+        //순위는 첫 node가 1, head가 0입니다.
+        template <class Before>
+        _node_base *_search(Before before, _node_base **path, size_type *ranks = nullptr) const
+        {
+            _node_base *current = this->_head_node();
+            size_type rank = 0;
+            for (size_type i = this->_level; i-- > 0;)
+            {
+                for (const _link *link = &current->link(i); link->next != nullptr && before(link->next, rank + link->span); link = &current->link(i))
+                {
+                    rank += link->span;
+                    current = link->next;
+                }
+                if (path != nullptr)
+                    path[i] = current;
+                if (ranks != nullptr)
+                    ranks[i] = rank;
+            }
+            return current;
+        }
+
+        //이전 검색의 경로에서 출발해, 목표와 가까운 높이까지만 올라갔다가 내려옵니다.
+        template <class Before>
+        _node_base *_finger_search(finger &f, Before before) const
+        {
+            _node_base **path = f._path;
+            if (f._owner != this || f._version != this->_version)
+            {
+                f._owner = this;
+                f._version = this->_version;
+                return this->_search(before, path);
+            }
+
+            _node_base *head = this->_head_node();
+            size_type level = 0;
+            if (path[0] == head || before(path[0], 0))
+            {
+                //앞으로: 윗층 link도 목표를 넘지 않는 동안 올라갑니다. 그보다 위층의 경로는 그대로 유효합니다.
+                while (level + 1 < this->_level)
+                {
+                    _node_base *next = path[level + 1]->next(level + 1);
+                    if (next == nullptr || !before(next, 0))
+                        break;
+                    level++;
+                }
+            }
+            else
+            {
+                //뒤로: 목표보다 앞에 있는 경로가 나올 때까지 올라갑니다.
+                while (level < this->_level && path[level] != head && !before(path[level], 0))
+                    level++;
+                if (level == this->_level)
+                    return this->_search(before, path);
+            }
+
+            _node_base *current = path[level];
+            for (size_type i = level + 1; i-- > 0;)
+            {
+                for (_node_base *next = current->next(i); next != nullptr && before(next, 0); next = current->next(i))
+                    current = next;
+                path[i] = current;
+            }
+            return current;
+        }
+
+        _node_base *_lower_predecessor(const key_type &key, _node_base **path, size_type *ranks = nullptr) const
+        {
+            return this->_search([&](const _node_base *node, size_type) { return this->_compare(_value(node), key); }, path, ranks);
+        }
+        _node_base *_upper_predecessor(const key_type &key, _node_base **path, size_type *ranks = nullptr) const
+        {
+            return this->_search([&](const _node_base *node, size_type) { return !this->_compare(key, _value(node)); }, path, ranks);
+        }
+        //순위가 rank보다 작은 마지막 node들입니다. (rank는 1부터)
+        _node_base *_rank_predecessor(size_type rank, _node_base **path) const
         {
-            for (int i = 0; i < count; i++)
-                this->push_back(value);
+            return this->_search([&](const _node_base *, size_type node_rank) { return node_rank < rank; }, path);
         }
-        skip_list(std::initializer_list<value_type> init)
+
+    private: //link
+        //path[i]는 level i에서 node 바로 앞에 올 node이고 ranks[i]는 그 순위입니다.
+        void _link_node(_node_base *node, _node_base **path, size_type *ranks) noexcept
+        {
+            for (size_type i = this->_level; i < node->level; i++)
+            {
+                path[i] = this->_head_node();
+                ranks[i] = 0;
+                path[i]->link(i) = _link{nullptr, this->_length + 1};
+            }
+            if (node->level > this->_level)
+                this->_level = node->level;
+
+            //node의 순위는 ranks[0] + 1입니다.
+            for (size_type i = 0; i < node->level; i++)
+            {
+                _link &before = path[i]->link(i);
+                size_type skipped = ranks[0] - ranks[i];
+                node->link(i) = _link{before.next, before.span - skipped};
+                before = _link{node, skipped + 1};
+            }
+            for (size_type i = node->level; i < this->_level; i++)
+                path[i]->span(i)++;
+            node->prev = path[0] == this->_head_node() ? nullptr : path[0];
+            if (node->next(0) != nullptr)
+                node->next(0)->prev = node;
+            else
+                this->_tail = node;
+
+            this->_length++;
+            this->_version++;
+        }
+
+        //path[i]는 level i에서 node를 건너뛰거나 가리키는 마지막 node입니다.
+        void _unlink_node(_node_base *node, _node_base **path) noexcept
         {
-            for (auto& e : init)
-                this->push_back(e);
+            for (size_type i = 0; i < this->_level; i++)
+            {
+                _link &before = path[i]->link(i);
+                if (before.next == node)
+                    before = _link{node->next(i), before.span + node->span(i) - 1};
+                else
+                    before.span--;
+            }
+            if (node->next(0) != nullptr)
+                node->next(0)->prev = node->prev;
+            else
+                this->_tail = node->prev;
+
+            while (this->_level > 1 && this->_head_node()->next(this->_level - 1) == nullptr)
+                this->_level--;
+            this->_length--;
+            this->_version++;
+        }
+
+        //node 하나를 지울 때 쓸 path를 값으로 찾습니다.
+        void _unlink_path(const _node_base *node, _node_base **path) const
+        {
+            this->_lower_predecessor(_value(node), path);
+            //같은 값이 여러 개면 그 사이의 node들이 더 가까운 선행 node일 수 있습니다.
+            for (_node_base *current = path[0]->next(0); current != node; current = current->next(0))
+                for (size_type i = 0; i < current->level; i++)
+                    path[i] = current;
         }
+
+        //정렬된 입력을 검색 없이 뒤에 붙입니다. 비어 있는 list에서만 부릅니다.
         template <class InputIterator>
-        skip_list(InputIterator begin, InputIterator end)
+        void _append_sorted(InputIterator first, InputIterator last)
         {
-            for (; begin != end; begin++)
-                this->push_back(*begin);
+            _node_base *path[max_level];
+            size_type ranks[max_level];
+            for (size_type i = 0; i < max_level; i++)
+            {
+                path[i] = this->_head_node();
+                ranks[i] = 0;
+            }
+
+            for (; first != last; ++first)
+            {
+                _node_base *node = _create_node(this->_random_level(), *first);
+                this->_link_node(node, path, ranks);
+                for (size_type i = 0; i < node->level; i++)
+                {
+                    path[i] = node;
+                    ranks[i] = this->_length;
+                }
+            }
         }
 
     public:
-        void assign(size_type count, const_reference value = value_type())
+        skip_list()
         {
-            this->clear();
-            for (int i = 0; i < count; i++)
-                this->push_back(value);
+            this->_reset_head();
         }
-        void assign(std::initializer_list<value_type> init)
+        //같은 seed와 같은 삽입 순서는 항상 같은 높이 배치를 만듭니다.
+        explicit skip_list(const Compare &compare, std::uint64_t seed = default_seed) : _compare(compare)
         {
-            this->clear();
-            for (auto& e : init)
-                this->push_back(e);
+            this->_reset_head();
+            this->seed(seed);
+        }
+        skip_list(std::initializer_list<value_type> init, const Compare &compare = Compare()) : _compare(compare)
+        {
+            this->_reset_head();
+            this->insert(init.begin(), init.end());
         }
         template <class InputIterator>
-        void assign(InputIterator begin, InputIterator end)
+        skip_list(InputIterator first, InputIterator last, const Compare &compare = Compare()) : _compare(compare)
+        {
+            this->_reset_head();
+            this->insert(first, last);
+        }
+        ~skip_list()
         {
             this->clear();
-            for (; begin != end; begin++)
-                this->push_back(*begin);
         }
 
     public: // copy&move member
-        skip_list(const Self& other) : circular_list(other.begin(), other.end())
-        {}
-        skip_list(Self&& other) : _head(other._head), _length(other._length)
+        skip_list(const Self &other) : _random(other._random), _compare(other._compare)
+        {
+            this->_reset_head();
+            try
+            {
+                this->_append_sorted(other.begin(), other.end());
+            }
+            catch (...)
+            {
+                this->clear();
+                throw;
+            }
+        }
+        skip_list(Self &&other) noexcept : _random(other._random), _compare(other._compare)
         {
-            other._head = nullptr;
-            other._length = 0;
+            this->_reset_head();
+            this->swap(other);
         }
-        Self& operator=(const Self& other)
+        Self &operator=(const Self &other)
         {
-            this->assign(other.begin(), other.end());
+            if (this != &other)
+            {
+                this->clear();
+                this->_compare = other._compare;
+                this->_append_sorted(other.begin(), other.end());
+            }
             return *this;
         }
-        Self& operator=(Self&& other)
+        Self &operator=(Self &&other) noexcept
         {
-            this->_head = other._head;
-            this->_length = other._length;
-            other._head = nullptr;
-            other._length = 0;
+            if (this != &other)
+            {
+                this->clear();
+                this->swap(other);
+            }
             return *this;
         }
 
-    public: //Element Access
-        reference front()
+    public:
+        void assign(std::initializer_list<value_type> init)
         {
-            assert(this->_head != nullptr);
-            return this->_head->value;
+            this->clear();
+            this->insert(init.begin(), init.end());
         }
-        const_reference front() const
+        template <class InputIterator>
+        void assign(InputIterator first, InputIterator last)
         {
-            assert(this->_head != nullptr);
-            return this->_head->value;
+            this->clear();
+            this->insert(first, last);
         }
-        reference back()
+
+        //이후 삽입되는 node의 높이를 정하는 난수 상태를 다시 정합니다.
+        void seed(std::uint64_t value) noexcept
         {
-            assert(this->_head != nullptr);
-            return this->_head->prev->value;
+            this->_random = value == 0 ? default_seed : value;
+        }
+
+    public: //Element Access
+        const_reference front() const
+        {
+            assert(this->_length != 0);
+            return _value(this->_head_node()->next(0));
         }
         const_reference back() const
         {
-            assert(this->_head != nullptr);
-            return this->_head->prev->value;
+            assert(this->_length != 0);
+            return _value(this->_tail);
         }
 
     public: //Capacity
@@ -145,259 +461,367 @@ namespace xstl
         {
             return this->_length;
         }
+        //현재 가장 높은 node의 높이입니다.
+        size_type height() const noexcept
+        {
+            return this->_level;
+        }
+        key_compare key_comp() const
+        {
+            return this->_compare;
+        }
+        value_compare value_comp() const
+        {
+            return this->_compare;
+        }
 
-    public:
+    public: //modifiers
         //Clear All Data
         void clear() noexcept
         {
-            if (!this->empty())
-                this->pop_front();
+            _node_base *current = this->_head_node()->next(0);
+            while (current != nullptr)
+            {
+                _node_base *next = current->next(0);
+                _destroy_node(current);
+                current = next;
+            }
+            this->_reset_head();
         }
 
         //Swap
-        void swap(Self& other) noexcept;
-
-    public: //front modifier
-        void push_front(const_reference value);        
-        void push_front(value_type&& value);
-
-        void pop_front();
-
-        template <class... Args>
-        void emplace_front(Args&&... args);
-
-    public: // back modifier
-        void push_back(const_reference value);
-        void push_back(value_type&& value);
-        void pop_back();
+        void swap(Self &other) noexcept
+        {
+            //node는 head를 가리키지 않으므로 head의 link만 맞바꾸면 됩니다.
+            using std::swap;
+            swap(this->_head.links, other._head.links);
+            swap(this->_tail, other._tail);
+            swap(this->_level, other._level);
+            swap(this->_length, other._length);
+            swap(this->_random, other._random);
+            swap(this->_compare, other._compare);
+            this->_version++;
+            other._version++;
+        }
 
+        //같은 값이 있으면 그 뒤에 넣습니다.
         template <class... Args>
-        void emplace_back(Args&&... args);
-
-    public:
-        iterator insert(const_iterator pos, const_reference value);
-        iterator insert(const_iterator pos, value_type&& value);
-
-        iterator insert(const_iterator pos, size_type count, const_reference value);
-
+        iterator emplace(Args &&... args)
+        {
+            _node_base *node = _create_node(this->_random_level(), std::forward<Args>(args)...);
+            _node_base *path[max_level];
+            size_type ranks[max_level];
+            this->_upper_predecessor(_value(node), path, ranks);
+            this->_link_node(node, path, ranks);
+            return iterator(node, this);
+        }
+        iterator insert(const_reference value)
+        {
+            return this->emplace(value);
+        }
+        iterator insert(value_type &&value)
+        {
+            return this->emplace(std::move(value));
+        }
         template <class InputIterator>
-        iterator insert(const_iterator pos, InputIterator begin, InputIterator end);
-        iterator insert(const_iterator pos, std::initializer_list<T> init);
-
-        template <class... Args>
-        iterator emplace(const_iterator pos, Args&&... args);
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+                this->emplace(*first);
+        }
+        void insert(std::initializer_list<value_type> init)
+        {
+            this->insert(init.begin(), init.end());
+        }
 
-        iterator erase(const_iterator pos);
-        iterator erase(const_iterator begin, const_iterator end);
+        iterator erase(const_iterator pos)
+        {
+            assert(pos.current != nullptr);
+            _node_base *node = const_cast<_node_base *>(pos.current);
+            _node_base *next = node->next(0);
+            _node_base *path[max_level];
+            this->_unlink_path(node, path);
+            this->_unlink_node(node, path);
+            _destroy_node(node);
+            return iterator(next, this);
+        }
+        //index번째(0부터) 값을 지우고 그 다음 값을 가리킵니다.
+        iterator erase_at(size_type index)
+        {
+            assert(index < this->_length);
+            _node_base *path[max_level];
+            _node_base *node = this->_rank_predecessor(index + 1, path)->next(0);
+            _node_base *next = node->next(0);
+            this->_unlink_node(node, path);
+            _destroy_node(node);
+            return iterator(next, this);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+                first = this->erase(first);
+            return iterator(last.current, this);
+        }
+        //key와 같은 값을 모두 지우고 그 개수를 돌려줍니다.
+        size_type erase(const key_type &key)
+        {
+            size_type count = 0;
+            for (const_iterator current = this->lower_bound(key); current != this->end() && !this->_compare(key, *current); count++)
+                current = this->erase(current);
+            return count;
+        }
 
-        void resize(size_type count, const_reference new_value = value_type());
+    public: //lookup
+        //key보다 작지 않은 첫 값입니다.
+        const_iterator lower_bound(const key_type &key) const
+        {
+            return const_iterator(this->_lower_predecessor(key, nullptr)->next(0), this);
+        }
+        //key보다 큰 첫 값입니다.
+        const_iterator upper_bound(const key_type &key) const
+        {
+            return const_iterator(this->_upper_predecessor(key, nullptr)->next(0), this);
+        }
+        std::pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+        {
+            return {this->lower_bound(key), this->upper_bound(key)};
+        }
+        const_iterator find(const key_type &key) const
+        {
+            const_iterator found = this->lower_bound(key);
+            return found != this->end() && !this->_compare(key, *found) ? found : this->end();
+        }
+        bool contains(const key_type &key) const
+        {
+            return this->find(key) != this->end();
+        }
+        size_type count(const key_type &key) const
+        {
+            size_type count = 0;
+            for (const_iterator current = this->lower_bound(key); current != this->end() && !this->_compare(key, *current); ++current)
+                count++;
+            return count;
+        }
 
-    public: //iterator
-        iterator begin()
+    public: //positional access
+        //index번째(0부터) 값을 가리킵니다. 범위를 벗어나면 end()입니다.
+        const_iterator nth(size_type index) const
+        {
+            if (index >= this->_length)
+                return this->end();
+            return const_iterator(this->_rank_predecessor(index + 1, nullptr)->next(0), this);
+        }
+        const_reference at(size_type index) const
         {
-            return iterator(this->_head);
+            if (index >= this->_length)
+                throw std::out_of_range("skip_list::at");
+            return *this->nth(index);
         }
-        iterator end()
+        const_reference operator[](size_type index) const
         {
-            return iterator(nullptr);
+            assert(index < this->_length);
+            return *this->nth(index);
         }
-        const_iterator begin() const
+        //key보다 작은 값의 개수, 즉 lower_bound(key)의 index입니다.
+        size_type rank(const key_type &key) const
         {
-            return this->cbegin();
+            size_type ranks[max_level];
+            this->_lower_predecessor(key, nullptr, ranks);
+            return ranks[0];
+        }
+        //pos의 index입니다. end()면 size()입니다.
+        size_type index_of(const_iterator pos) const
+        {
+            if (pos.current == nullptr)
+                return this->_length;
+            //같은 값이 여러 개면 첫 번째부터 pos까지 걷습니다.
+            size_type ranks[max_level];
+            const _node_base *current = this->_lower_predecessor(*pos, nullptr, ranks)->next(0);
+            size_type index = ranks[0];
+            for (; current != pos.current; current = current->next(0))
+                index++;
+            return index;
         }
-        const_iterator end() const
+
+    public: //finger search
+        //f에 남은 직전 위치에서 출발합니다. 가까운 key를 연달아 찾으면 거리의 log만큼만 움직입니다.
+        //list가 바뀐 뒤에는 자동으로 head부터 다시 찾습니다.
+        const_iterator lower_bound(const key_type &key, finger &f) const
         {
-            return this->cend();
+            return const_iterator(this->_finger_search(f, [&](const _node_base *node, size_type) { return this->_compare(_value(node), key); })->next(0), this);
         }
-        const_iterator cbegin() const
+        const_iterator upper_bound(const key_type &key, finger &f) const
         {
-            return const_iterator(this->_head);
+            return const_iterator(this->_finger_search(f, [&](const _node_base *node, size_type) { return !this->_compare(key, _value(node)); })->next(0), this);
         }
-        const_iterator cend() const
+        const_iterator find(const key_type &key, finger &f) const
         {
-            return const_iterator(nullptr);
+            const_iterator found = this->lower_bound(key, f);
+            return found != this->end() && !this->_compare(key, *found) ? found : this->end();
         }
 
-    public: //reverse iterator
-        reverse_iterator rbegin()
+        //[first, last) 구간의 값들입니다. 두 번째 경계는 첫 경계의 경로에서 이어서 찾고, 순회는 level 0만 따라갑니다.
+        range_type range(const key_type &first, const key_type &last) const
+        {
+            finger f;
+            const_iterator begin = this->lower_bound(first, f);
+            if (!this->_compare(first, last))
+                return range_type(begin, begin);
+            return range_type(begin, this->lower_bound(last, f));
+        }
+
+    public: //iterator
+        const_iterator begin() const noexcept
         {
-            return reverse_iterator(this->_head);
+            return const_iterator(this->_head_node()->next(0), this);
         }
-        reverse_iterator rend()
+        const_iterator end() const noexcept
         {
-            return reverse_iterator(nullptr);
+            return const_iterator(nullptr, this);
         }
-        const_reverse_iterator rbegin() const
+        const_iterator cbegin() const noexcept
         {
-            return this->cbegin();
+            return this->begin();
         }
-        const_reverse_iterator rend() const
+        const_iterator cend() const noexcept
         {
-            return this->cend();
+            return this->end();
         }
-        const_reverse_iterator crbegin() const
+
+    public: //reverse iterator
+        const_reverse_iterator rbegin() const noexcept
         {
-            return const_reverse_iterator(this->_head);
+            return const_reverse_iterator(this->end());
         }
-        const_reverse_iterator crend() const
+        const_reverse_iterator rend() const noexcept
         {
-            return const_reverse_iterator(nullptr);
+            return const_reverse_iterator(this->begin());
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return this->rbegin();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return this->rend();
         }
 
     public:
-        class iterator
+        class const_iterator
         {
         private:
-            node_type* current;
+            friend skip_list;
+            const _node_base *current = nullptr;
+            const skip_list *owner = nullptr; //end()에서 --할 때 tail을 찾기 위함입니다.
+
         public:
-            using Self = iterator;
-            friend const_iterator;
-            friend circular_list;
+            using Self = const_iterator;
+
         public:
-            using value_type = value_type;
-            using pointer = pointer;
-            using reference = reference;
+            using value_type = typename skip_list::value_type;
+            using pointer = typename skip_list::const_pointer;
+            using reference = typename skip_list::const_reference;
             using difference_type = std::ptrdiff_t;
             using iterator_category = std::bidirectional_iterator_tag;
+
         public:
-            iterator() = delete;
-            virtual ~iterator() = default;
-        public: //move & copy member
-            iterator(const Self&) = default;
-            iterator(Self&&) = default;
-            Self& operator=(const Self&) = default;
-            Self& operator=(Self&&) = default;
-        public:
-            iterator(node_type* p) : current(p)
-            {}
+            const_iterator() = default;
+            const_iterator(const _node_base *p, const skip_list *list) : current(p), owner(list)
+            {
+            }
+
         public: //move operator
-            Self& operator++()
+            Self &operator++()
             {
                 assert(current != nullptr);
-                current = current->next;
+                current = current->next(0);
                 return *this;
             }
             Self operator++(int)
             {
-                assert(current != nullptr);
-                current = current->next;
-                return *this;
+                Self old = *this;
+                ++*this;
+                return old;
             }
-            Self& operator--()
+            Self &operator--()
             {
+                current = current == nullptr ? owner->_tail : current->prev;
                 assert(current != nullptr);
-                current = current->prev;
                 return *this;
             }
             Self operator--(int)
             {
-                assert(current != nullptr);
-                current = current->prev;
-                return *this;
+                Self old = *this;
+                --*this;
+                return old;
             }
+
         public: //access operator
-            reference operator*()
-            {
-                assert(current != nullptr);
-                return current->value;
-            }
-            const_reference operator*() const
+            reference operator*() const
             {
                 assert(current != nullptr);
-                return current->value;
+                return _value(current);
             }
-            pointer operator->()
+            pointer operator->() const
             {
                 assert(current != nullptr);
-                return &current->value;
-            }
-            const_pointer operator->() const
-            {
-                assert(current != nullptr);
-                return &current->value;
+                return &_value(current);
             }
+
         public: //comparer
-            bool operator==(const Self& other) const
+            bool operator==(const Self &other) const
             {
                 return this->current == other.current;
             }
-            bool operator!=(const Self& other) const
+            bool operator!=(const Self &other) const
             {
                 return this->current != other.current;
             }
         };
 
-        class const_iterator
+        //직전 검색의 층별 경로입니다. 같은 list에 대해 여러 번 재사용합니다.
+        class finger
         {
         private:
-            const node_type* current;
-        public:
-            using Self = const_iterator;
-            friend circular_list;
-        public:
-            using value_type = value_type;
-            using pointer = pointer;
-            using reference = reference;
-            using difference_type = std::ptrdiff_t;
-            using iterator_category = std::bidirectional_iterator_tag;
+            friend skip_list;
+            const skip_list *_owner = nullptr;
+            size_type _version = 0;
+            _node_base *_path[max_level];
+
         public:
-            const_iterator() = delete;
-            ~const_iterator() = default;
-        public: //move & copy member
-            const_iterator(const Self&) = default;
-            const_iterator(Self&&) = default;
-            Self& operator=(const Self&) = default;
-            Self& operator=(Self&&) = default;
+            finger() = default;
+        };
+
+        //range-for에 바로 쓸 수 있는 [begin, end) 쌍입니다.
+        class range_type
+        {
+        private:
+            const_iterator _first;
+            const_iterator _last;
+
         public:
-            const_iterator(node_type* p) : current(p)
-            {}
-            const_iterator(const iterator& mutable_iterator) : current(mutable_iterator.current)
-            {}
-        public: //move operator
-            Self& operator++()
+            range_type(const_iterator first, const_iterator last) : _first(first), _last(last)
             {
-                assert(current != nullptr);
-                current = current->next;
-                return *this;
             }
-            Self operator++(int)
+            const_iterator begin() const
             {
-                assert(current != nullptr);
-                current = current->next;
-                return *this;
+                return this->_first;
             }
-            Self& operator--()
+            const_iterator end() const
             {
-                assert(current != nullptr);
-                current = current->prev;
-                return *this;
+                return this->_last;
             }
-            Self operator--(int)
+            bool empty() const
             {
-                assert(current != nullptr);
-                current = current->prev;
-                return *this;
-            }
-        public: //access operator
-            const_reference operator*() const
-            {
-                assert(current != nullptr);
-                return current->value;
-            }
-            const_pointer operator->() const
-            {
-                assert(current != nullptr);
-                return &current->value;
-            }
-        public: //comparer
-            bool operator==(const Self& other) const
-            {
-                return this->current == other.current;
-            }
-            bool operator!=(const Self& other) const
-            {
-                return this->current != other.current;
+                return this->_first == this->_last;
             }
         };
     };
-}
+
+    template <class T, class Compare>
+    constexpr typename skip_list<T, Compare>::size_type skip_list<T, Compare>::max_level;
+    template <class T, class Compare>
+    constexpr std::uint64_t skip_list<T, Compare>::default_seed;
+} // namespace xstl
+
+#endif
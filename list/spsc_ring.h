@@ -0,0 +1,224 @@
+#ifndef __XSTL_SPSC_RING__
+#define __XSTL_SPSC_RING__
+
+/*
+    Bounded Single-Producer Single-Consumer Ring Buffer.
+    A FIFO between exactly one producer thread and one consumer thread, without locks or allocation.
+    N must be a power of two. head and tail live on separate cache lines, and each side caches
+    the other side's index so it touches the shared line only when the ring looks full/empty.
+*/
+
+#include <cstddef>
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../utility/atomic_wait.h"
+
+namespace xstl
+{
+    template <class T, std::size_t N>
+    class spsc_ring
+    {
+        static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+
+    public:
+        using Self = spsc_ring;
+
+    public: //stl standard type member
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+
+    private:
+        static constexpr size_type _mask = N - 1;
+
+        //consumer가 쓰는 줄
+        alignas(64) std::atomic<size_type> _head{0};
+        size_type _cached_tail = 0;
+
+        //producer가 쓰는 줄
+        alignas(64) std::atomic<size_type> _tail{0};
+        size_type _cached_head = 0;
+
+        //blocking 대기는 드물게 쓰이므로 따로 둡니다.
+        alignas(64) _wait_channel _not_empty;
+        _wait_channel _not_full;
+
+        alignas(64) typename std::aligned_storage<sizeof(T), alignof(T)>::type _buffer[N];
+
+    private:
+        T *_slot(size_type position) noexcept
+        {
+            return reinterpret_cast<T *>(&this->_buffer[position & _mask]);
+        }
+
+        //producer 쪽: 지금 쓸 수 있는 칸 수입니다.
+        size_type _free_count(size_type tail, size_type wanted) noexcept
+        {
+            size_type free = N - (tail - this->_cached_head);
+            if (free < wanted)
+            {
+                this->_cached_head = this->_head.load(std::memory_order_acquire);
+                free = N - (tail - this->_cached_head);
+            }
+            return free;
+        }
+        //consumer 쪽: 지금 읽을 수 있는 요소 수입니다.
+        size_type _ready_count(size_type head, size_type wanted) noexcept
+        {
+            size_type ready = this->_cached_tail - head;
+            if (ready < wanted)
+            {
+                this->_cached_tail = this->_tail.load(std::memory_order_acquire);
+                ready = this->_cached_tail - head;
+            }
+            return ready;
+        }
+
+    public:
+        spsc_ring() = default;
+        ~spsc_ring()
+        {
+            size_type tail = this->_tail.load(std::memory_order_relaxed);
+            for (size_type head = this->_head.load(std::memory_order_relaxed); head != tail; head++)
+                this->_slot(head)->~T();
+        }
+
+    public: //not copyable, not movable
+        spsc_ring(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public: //producer
+        template <class... Args>
+        bool try_emplace(Args &&... args)
+        {
+            size_type tail = this->_tail.load(std::memory_order_relaxed);
+            if (this->_free_count(tail, 1) == 0)
+                return false;
+
+            ::new (static_cast<void *>(this->_slot(tail))) T(std::forward<Args>(args)...);
+            this->_tail.store(tail + 1, std::memory_order_release);
+            this->_not_empty.notify();
+            return true;
+        }
+        bool try_push(const value_type &value)
+        {
+            return this->try_emplace(value);
+        }
+        bool try_push(value_type &&value)
+        {
+            return this->try_emplace(std::move(value));
+        }
+
+        //[first, first + count)에서 들어가는 만큼 넣고 그 개수를 돌려줍니다. tail은 한 번만 갱신합니다.
+        template <class InputIterator>
+        size_type try_push_bulk(InputIterator first, size_type count)
+        {
+            size_type tail = this->_tail.load(std::memory_order_relaxed);
+            size_type free = this->_free_count(tail, count);
+            size_type n = free < count ? free : count;
+            if (n == 0)
+                return 0;
+
+            for (size_type i = 0; i < n; i++, ++first)
+                ::new (static_cast<void *>(this->_slot(tail + i))) T(*first);
+            this->_tail.store(tail + n, std::memory_order_release);
+            this->_not_empty.notify();
+            return n;
+        }
+
+        //자리가 날 때까지 기다립니다.
+        void push(const value_type &value)
+        {
+            this->_not_full.wait_until([&] { return this->try_emplace(value); });
+        }
+        void push(value_type &&value)
+        {
+            this->_not_full.wait_until([&] { return this->try_emplace(std::move(value)); });
+        }
+        //count개를 모두 넣을 때까지 기다립니다.
+        template <class InputIterator>
+        void push_bulk(InputIterator first, size_type count)
+        {
+            while (count > 0)
+            {
+                size_type pushed = 0;
+                this->_not_full.wait_until([&] { return (pushed = this->try_push_bulk(first, count)) != 0; });
+                std::advance(first, pushed);
+                count -= pushed;
+            }
+        }
+
+    public: //consumer
+        bool try_pop(value_type &out)
+        {
+            size_type head = this->_head.load(std::memory_order_relaxed);
+            if (this->_ready_count(head, 1) == 0)
+                return false;
+
+            T *item = this->_slot(head);
+            out = std::move(*item);
+            item->~T();
+            this->_head.store(head + 1, std::memory_order_release);
+            this->_not_full.notify();
+            return true;
+        }
+
+        //최대 max개를 out으로 옮기고 그 개수를 돌려줍니다. head는 한 번만 갱신합니다.
+        template <class OutputIterator>
+        size_type try_pop_bulk(OutputIterator out, size_type max)
+        {
+            size_type head = this->_head.load(std::memory_order_relaxed);
+            size_type ready = this->_ready_count(head, max);
+            size_type n = ready < max ? ready : max;
+            if (n == 0)
+                return 0;
+
+            for (size_type i = 0; i < n; i++, ++out)
+            {
+                T *item = this->_slot(head + i);
+                *out = std::move(*item);
+                item->~T();
+            }
+            this->_head.store(head + n, std::memory_order_release);
+            this->_not_full.notify();
+            return n;
+        }
+
+        //요소가 들어올 때까지 기다립니다.
+        void pop(value_type &out)
+        {
+            this->_not_empty.wait_until([&] { return this->try_pop(out); });
+        }
+        //하나 이상 들어올 때까지 기다린 뒤 최대 max개를 꺼냅니다.
+        template <class OutputIterator>
+        size_type pop_bulk(OutputIterator out, size_type max)
+        {
+            size_type popped = 0;
+            if (max != 0)
+                this->_not_empty.wait_until([&] { return (popped = this->try_pop_bulk(out, max)) != 0; });
+            return popped;
+        }
+
+    public: //capacity
+        //다른 thread가 동작 중이면 근사값입니다.
+        size_type size() const noexcept
+        {
+            size_type head = this->_head.load(std::memory_order_acquire);
+            return this->_tail.load(std::memory_order_acquire) - head;
+        }
+        bool empty() const noexcept
+        {
+            return this->size() == 0;
+        }
+        static constexpr size_type capacity() noexcept
+        {
+            return N;
+        }
+    };
+} // namespace xstl
+
+#endif
@@ -0,0 +1,730 @@
+#ifndef __XSTL_UNROLLED_CIRCULAR_LIST__
+#define __XSTL_UNROLLED_CIRCULAR_LIST__
+
+/*
+    Unrolled Circular List.
+    Same ring semantics as circular_list, but every node stores a small inline array of elements.
+    Node capacity is chosen from sizeof(T) so that one node fills about two cache lines.
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <initializer_list>
+
+namespace xstl
+{
+    //노드 하나가 대략 캐시라인 2개(128 byte)를 채우도록 요소 개수를 정합니다.
+    template <class T>
+    struct unrolled_node_capacity
+    {
+        static constexpr std::size_t _header_size = sizeof(void *) * 2 + sizeof(std::size_t) * 2;
+        static constexpr std::size_t _fit_count = sizeof(T) < 128 - _header_size ? (128 - _header_size) / sizeof(T) : 1;
+        static constexpr std::size_t value = _fit_count < 2 ? 1 : _fit_count;
+    };
+
+    template <class T, std::size_t NodeCapacity = unrolled_node_capacity<T>::value>
+    class unrolled_circular_list
+    {
+        static_assert(NodeCapacity > 0, "NodeCapacity must be positive");
+
+    public:
+        using Self = unrolled_circular_list;
+
+    public: //stl standard type member
+        using value_type = T;
+        struct node_type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        class iterator;
+        class const_iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type node_capacity = NodeCapacity;
+
+    private:
+        node_type *_head = nullptr;
+        size_type _length = 0;
+
+    public: //list node type
+        //요소는 [first, last) 슬롯에 연속으로 저장됩니다.
+        struct node_type
+        {
+            using Self = node_type;
+
+        public:
+            Self *prev;
+            Self *next;
+            size_type first;
+            size_type last;
+            typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type storage[NodeCapacity];
+
+        public:
+            node_type() = delete;
+            node_type(size_type _offset) : prev(this), next(this), first(_offset), last(_offset)
+            {
+            }
+
+        public:
+            pointer slot(size_type index)
+            {
+                return reinterpret_cast<pointer>(&storage[index]);
+            }
+            const_pointer slot(size_type index) const
+            {
+                return reinterpret_cast<const_pointer>(&storage[index]);
+            }
+            size_type count() const
+            {
+                return last - first;
+            }
+        };
+
+    private: //node ring helper
+        //node를 position 뒤에 연결합니다.
+        static void _link_after(node_type *position, node_type *node)
+        {
+            node->prev = position;
+            node->next = position->next;
+            position->next->prev = node;
+            position->next = node;
+        }
+
+        void _unlink(node_type *node)
+        {
+            if (node->next == node)
+                this->_head = nullptr;
+            else
+            {
+                if (this->_head == node)
+                    this->_head = node->next;
+                node->prev->next = node->next;
+                node->next->prev = node->prev;
+            }
+            delete node;
+        }
+
+        //새 요소가 들어갈 빈 슬롯을 만들고 그 위치를 반환합니다. node에는 여유 공간이 있어야 합니다.
+        static size_type _make_hole(node_type *node, size_type position)
+        {
+            if (node->last < NodeCapacity)
+            {
+                for (size_type i = node->last; i > position; i--)
+                {
+                    ::new (node->slot(i)) value_type(std::move(*node->slot(i - 1)));
+                    node->slot(i - 1)->~value_type();
+                }
+                node->last++;
+                return position;
+            }
+            else
+            {
+                assert(node->first > 0);
+                for (size_type i = node->first; i < position; i++)
+                {
+                    ::new (node->slot(i - 1)) value_type(std::move(*node->slot(i)));
+                    node->slot(i)->~value_type();
+                }
+                node->first--;
+                return position - 1;
+            }
+        }
+
+        //가득 찬 node를 반으로 나누고, 뒤쪽 절반을 새 node로 옮깁니다.
+        node_type *_split(node_type *node)
+        {
+            size_type middle = node->first + node->count() / 2;
+            node_type *back_half = new node_type(0);
+
+            for (size_type i = middle; i < node->last; i++)
+            {
+                ::new (back_half->slot(back_half->last++)) value_type(std::move(*node->slot(i)));
+                node->slot(i)->~value_type();
+            }
+            node->last = middle;
+
+            _link_after(node, back_half);
+            return back_half;
+        }
+
+        template <class... Args>
+        iterator _emplace_at(node_type *node, size_type position, Args &&... args)
+        {
+            //args가 이 list의 요소를 가리킬 수 있으므로, 요소를 옮기기 전에 먼저 만들어 둡니다.
+            value_type value(std::forward<Args>(args)...);
+
+            if (NodeCapacity == 1 && node->count() == 1)
+            {
+                //나눌 수 없는 node이므로 앞이나 뒤에 새 node를 붙입니다.
+                node_type *single = new node_type(0);
+                _link_after(position == node->first ? node->prev : node, single);
+                if (position == node->first && node == this->_head)
+                    this->_head = single;
+
+                ::new (single->slot(0)) value_type(std::move(value));
+                single->last = 1;
+                this->_length++;
+
+                return iterator(this, single, 0);
+            }
+
+            if (node->count() == NodeCapacity)
+            {
+                size_type middle = node->first + node->count() / 2;
+                node_type *back_half = this->_split(node);
+
+                if (position > middle)
+                {
+                    position = position - middle;
+                    node = back_half;
+                }
+            }
+
+            position = _make_hole(node, position);
+            ::new (node->slot(position)) value_type(std::move(value));
+            this->_length++;
+
+            return iterator(this, node, position);
+        }
+
+        iterator _erase_at(node_type *node, size_type position)
+        {
+            node->slot(position)->~value_type();
+            for (size_type i = position + 1; i < node->last; i++)
+            {
+                ::new (node->slot(i - 1)) value_type(std::move(*node->slot(i)));
+                node->slot(i)->~value_type();
+            }
+            node->last--;
+            this->_length--;
+
+            if (node->count() == 0)
+            {
+                node_type *next = node->next;
+                bool was_tail = next == this->_head;
+                this->_unlink(node);
+
+                if (this->_head == nullptr || was_tail)
+                    return this->end();
+                return iterator(this, next, next->first);
+            }
+
+            if (position == node->last)
+            {
+                if (node->next == this->_head)
+                    return this->end();
+                return iterator(this, node->next, node->next->first);
+            }
+
+            return iterator(this, node, position);
+        }
+
+    public:
+        unrolled_circular_list() = default;
+        ~unrolled_circular_list()
+        {
+            this->clear();
+        }
+
+    public:
+        unrolled_circular_list(size_type count, const_reference value = value_type())
+        {
+            for (size_type i = 0; i < count; i++)
+                this->push_back(value);
+        }
+        unrolled_circular_list(std::initializer_list<value_type> init)
+        {
+            for (auto &e : init)
+                this->push_back(e);
+        }
+        template <class InputIterator>
+        unrolled_circular_list(InputIterator begin, InputIterator end)
+        {
+            for (; begin != end; ++begin)
+                this->push_back(*begin);
+        }
+
+    public:
+        void assign(size_type count, const_reference value = value_type())
+        {
+            this->clear();
+            for (size_type i = 0; i < count; i++)
+                this->push_back(value);
+        }
+        void assign(std::initializer_list<value_type> init)
+        {
+            this->clear();
+            for (auto &e : init)
+                this->push_back(e);
+        }
+        template <class InputIterator>
+        void assign(InputIterator begin, InputIterator end)
+        {
+            this->clear();
+            for (; begin != end; ++begin)
+                this->push_back(*begin);
+        }
+
+    public: // copy&move member
+        unrolled_circular_list(const Self &other) : unrolled_circular_list(other.begin(), other.end())
+        {
+        }
+        unrolled_circular_list(Self &&other) : _head(other._head), _length(other._length)
+        {
+            other._head = nullptr;
+            other._length = 0;
+        }
+        Self &operator=(const Self &other)
+        {
+            if (this != &other)
+                this->assign(other.begin(), other.end());
+            return *this;
+        }
+        Self &operator=(Self &&other)
+        {
+            if (this != &other)
+            {
+                this->clear();
+                this->swap(other);
+            }
+            return *this;
+        }
+
+    public: //Element Access
+        reference front()
+        {
+            assert(this->_head != nullptr);
+            return *this->_head->slot(this->_head->first);
+        }
+        const_reference front() const
+        {
+            assert(this->_head != nullptr);
+            return *this->_head->slot(this->_head->first);
+        }
+        reference back()
+        {
+            assert(this->_head != nullptr);
+            return *this->_head->prev->slot(this->_head->prev->last - 1);
+        }
+        const_reference back() const
+        {
+            assert(this->_head != nullptr);
+            return *this->_head->prev->slot(this->_head->prev->last - 1);
+        }
+
+    public: //Capacity
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+
+    public:
+        //Clear All Data
+        void clear() noexcept
+        {
+            while (this->_head != nullptr)
+            {
+                node_type *node = this->_head;
+                for (size_type i = node->first; i < node->last; i++)
+                    node->slot(i)->~value_type();
+                this->_unlink(node);
+            }
+            this->_length = 0;
+        }
+
+        //Swap
+        void swap(Self &other) noexcept
+        {
+            std::swap(this->_head, other._head);
+            std::swap(this->_length, other._length);
+        }
+
+    public: //front modifier
+        void push_front(const_reference value)
+        {
+            this->emplace_front(value);
+        }
+        void push_front(value_type &&value)
+        {
+            this->emplace_front(std::move(value));
+        }
+
+        template <class... Args>
+        void emplace_front(Args &&... args)
+        {
+            //앞쪽이 막혀 있으면 새 node를 만들고 오른쪽 끝부터 채웁니다.
+            if (this->_head == nullptr || this->_head->first == 0)
+            {
+                node_type *node = new node_type(NodeCapacity);
+                if (this->_head != nullptr)
+                    _link_after(this->_head->prev, node);
+                this->_head = node;
+            }
+
+            node_type *node = this->_head;
+            ::new (node->slot(node->first - 1)) value_type(std::forward<Args>(args)...);
+            node->first--;
+            this->_length++;
+        }
+
+        void pop_front()
+        {
+            assert(this->_head != nullptr);
+
+            node_type *node = this->_head;
+            node->slot(node->first)->~value_type();
+            node->first++;
+            this->_length--;
+
+            if (node->count() == 0)
+                this->_unlink(node);
+        }
+
+    public: // back modifier
+        void push_back(const_reference value)
+        {
+            this->emplace_back(value);
+        }
+        void push_back(value_type &&value)
+        {
+            this->emplace_back(std::move(value));
+        }
+
+        template <class... Args>
+        void emplace_back(Args &&... args)
+        {
+            //뒤쪽이 막혀 있으면 새 node를 만들고 왼쪽 끝부터 채웁니다.
+            if (this->_head == nullptr)
+                this->_head = new node_type(0);
+            else if (this->_head->prev->last == NodeCapacity)
+                _link_after(this->_head->prev, new node_type(0));
+
+            node_type *node = this->_head->prev;
+            ::new (node->slot(node->last)) value_type(std::forward<Args>(args)...);
+            node->last++;
+            this->_length++;
+        }
+
+        void pop_back()
+        {
+            assert(this->_head != nullptr);
+
+            node_type *node = this->_head->prev;
+            node->last--;
+            node->slot(node->last)->~value_type();
+            this->_length--;
+
+            if (node->count() == 0)
+                this->_unlink(node);
+        }
+
+    public:
+        //pos 앞에 요소를 추가합니다. pos가 end()이면 맨 뒤에 추가합니다.
+        iterator insert(const_iterator pos, const_reference value)
+        {
+            return this->emplace(pos, value);
+        }
+        iterator insert(const_iterator pos, value_type &&value)
+        {
+            return this->emplace(pos, std::move(value));
+        }
+
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args &&... args)
+        {
+            if (pos.current == nullptr)
+            {
+                this->emplace_back(std::forward<Args>(args)...);
+                node_type *tail = this->_head->prev;
+                return iterator(this, tail, tail->last - 1);
+            }
+
+            return this->_emplace_at(const_cast<node_type *>(pos.current), pos.index, std::forward<Args>(args)...);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            assert(pos.current != nullptr);
+            return this->_erase_at(const_cast<node_type *>(pos.current), pos.index);
+        }
+        iterator erase(const_iterator begin, const_iterator end)
+        {
+            //node가 해제되면 end 위치가 바뀔 수 있으므로, 지울 개수를 먼저 셉니다.
+            size_type count = std::distance(begin, end);
+            iterator position(this, const_cast<node_type *>(begin.current), begin.index);
+
+            for (; count > 0; count--)
+                position = this->erase(position);
+            return position;
+        }
+
+    public: //iterator
+        iterator begin()
+        {
+            return this->_head == nullptr ? this->end() : iterator(this, this->_head, this->_head->first);
+        }
+        iterator end()
+        {
+            return iterator(this, nullptr, 0);
+        }
+        const_iterator begin() const
+        {
+            return this->cbegin();
+        }
+        const_iterator end() const
+        {
+            return this->cend();
+        }
+        const_iterator cbegin() const
+        {
+            return this->_head == nullptr ? this->cend() : const_iterator(this, this->_head, this->_head->first);
+        }
+        const_iterator cend() const
+        {
+            return const_iterator(this, nullptr, 0);
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(this->end());
+        }
+        reverse_iterator rend()
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rbegin() const
+        {
+            return this->crbegin();
+        }
+        const_reverse_iterator rend() const
+        {
+            return this->crend();
+        }
+        const_reverse_iterator crbegin() const
+        {
+            return const_reverse_iterator(this->cend());
+        }
+        const_reverse_iterator crend() const
+        {
+            return const_reverse_iterator(this->cbegin());
+        }
+
+    public:
+        //마지막 node의 끝을 지나면 end()(nullptr)가 됩니다.
+        class iterator
+        {
+        private:
+            const unrolled_circular_list *list;
+            node_type *current;
+            size_type index;
+
+        public:
+            using Self = iterator;
+            friend const_iterator;
+            friend unrolled_circular_list;
+
+        public:
+            using value_type = unrolled_circular_list::value_type;
+            using pointer = unrolled_circular_list::pointer;
+            using reference = unrolled_circular_list::reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            iterator() = delete;
+            ~iterator() = default;
+
+        public: //move & copy member
+            iterator(const Self &) = default;
+            iterator(Self &&) = default;
+            Self &operator=(const Self &) = default;
+            Self &operator=(Self &&) = default;
+
+        public:
+            iterator(const unrolled_circular_list *l, node_type *p, size_type i) : list(l), current(p), index(i)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(current != nullptr);
+                if (++index == current->last)
+                {
+                    current = current->next == list->_head ? nullptr : current->next;
+                    index = current == nullptr ? 0 : current->first;
+                }
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                ++*this;
+                return temp;
+            }
+            Self &operator--()
+            {
+                if (current == nullptr)
+                {
+                    assert(list->_head != nullptr);
+                    current = list->_head->prev;
+                    index = current->last - 1;
+                }
+                else if (index == current->first)
+                {
+                    assert(current != list->_head);
+                    current = current->prev;
+                    index = current->last - 1;
+                }
+                else
+                    index--;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                --*this;
+                return temp;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                assert(current != nullptr);
+                return *current->slot(index);
+            }
+            pointer operator->() const
+            {
+                assert(current != nullptr);
+                return current->slot(index);
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current && this->index == other.index;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        class const_iterator
+        {
+        private:
+            const unrolled_circular_list *list;
+            const node_type *current;
+            size_type index;
+
+        public:
+            using Self = const_iterator;
+            friend unrolled_circular_list;
+
+        public:
+            using value_type = unrolled_circular_list::value_type;
+            using pointer = unrolled_circular_list::const_pointer;
+            using reference = unrolled_circular_list::const_reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            const_iterator() = delete;
+            ~const_iterator() = default;
+
+        public: //move & copy member
+            const_iterator(const Self &) = default;
+            const_iterator(Self &&) = default;
+            Self &operator=(const Self &) = default;
+            Self &operator=(Self &&) = default;
+
+        public:
+            const_iterator(const unrolled_circular_list *l, const node_type *p, size_type i) : list(l), current(p), index(i)
+            {
+            }
+            const_iterator(const iterator &mutable_iterator)
+                : list(mutable_iterator.list), current(mutable_iterator.current), index(mutable_iterator.index)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(current != nullptr);
+                if (++index == current->last)
+                {
+                    current = current->next == list->_head ? nullptr : current->next;
+                    index = current == nullptr ? 0 : current->first;
+                }
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self temp = *this;
+                ++*this;
+                return temp;
+            }
+            Self &operator--()
+            {
+                if (current == nullptr)
+                {
+                    assert(list->_head != nullptr);
+                    current = list->_head->prev;
+                    index = current->last - 1;
+                }
+                else if (index == current->first)
+                {
+                    assert(current != list->_head);
+                    current = current->prev;
+                    index = current->last - 1;
+                }
+                else
+                    index--;
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self temp = *this;
+                --*this;
+                return temp;
+            }
+
+        public: //access operator
+            const_reference operator*() const
+            {
+                assert(current != nullptr);
+                return *current->slot(index);
+            }
+            const_pointer operator->() const
+            {
+                assert(current != nullptr);
+                return current->slot(index);
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current && this->index == other.index;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return !(*this == other);
+            }
+        };
+    };
+} // namespace xstl
+
+#endif
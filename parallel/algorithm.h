@@ -0,0 +1,277 @@
+#ifndef __XSTL_PARALLEL_ALGORITHM__
+#define __XSTL_PARALLEL_ALGORITHM__
+
+/*
+    Parallel Algorithms (xstl::par).
+    fill, transform, reduce, inclusive_scan and sample sort over random access ranges,
+    running on xstl::thread_pool. The range is cut into chunks of `grain` elements.
+*/
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric> //partial_sum
+#include <utility>
+#include <vector>
+#include "./thread_pool.h"
+#include "./fork_join.h"
+#include "../array/fixed_vector.h"
+
+namespace xstl
+{
+    namespace par
+    {
+        using size_type = std::size_t;
+
+        //grain이 0이면 pool 크기에 맞춰 자동으로 정합니다. pool이 nullptr이면 default_pool을 씁니다.
+        struct options
+        {
+            size_type grain;
+            thread_pool *pool;
+
+            options(size_type grain = 0, thread_pool *pool = nullptr) : grain(grain), pool(pool)
+            {
+            }
+        };
+
+        inline thread_pool &_pool_of(const options &option)
+        {
+            return option.pool != nullptr ? *option.pool : thread_pool::default_pool();
+        }
+
+        //worker당 몇 개의 chunk가 돌아가도록 나눕니다.
+        inline size_type _grain_of(size_type length, const options &option)
+        {
+            if (option.grain != 0)
+                return option.grain;
+
+            size_type chunk_count = (_pool_of(option).size() + 1) * 4;
+            size_type grain = length / chunk_count;
+            return grain < 2048 ? 2048 : grain;
+        }
+
+        //[0, length)를 grain 단위 chunk로 나눠 function(chunk_index, begin, end)를 병렬 실행합니다.
+        template <class Function>
+        void _for_each_chunk(size_type length, size_type grain, const options &option, Function function)
+        {
+            size_type chunk_count = (length + grain - 1) / grain;
+            parallel_for(_pool_of(option), 0, chunk_count, 1, [&](size_type low, size_type high) {
+                for (size_type chunk = low; chunk < high; chunk++)
+                {
+                    size_type begin = chunk * grain;
+                    size_type end = begin + grain < length ? begin + grain : length;
+                    function(chunk, begin, end);
+                }
+            });
+        }
+
+        template <class RandomIterator, class T>
+        void fill(RandomIterator first, RandomIterator last, const T &value, const options &option = options())
+        {
+            size_type length = last - first;
+            _for_each_chunk(length, _grain_of(length, option), option, [&](size_type, size_type begin, size_type end) {
+                std::fill(first + begin, first + end, value);
+            });
+        }
+
+        template <class RandomIterator, class OutputIterator, class UnaryOperation>
+        OutputIterator transform(RandomIterator first, RandomIterator last, OutputIterator out, UnaryOperation operation, const options &option = options())
+        {
+            size_type length = last - first;
+            _for_each_chunk(length, _grain_of(length, option), option, [&](size_type, size_type begin, size_type end) {
+                std::transform(first + begin, first + end, out + begin, operation);
+            });
+            return out + length;
+        }
+        template <class RandomIterator1, class RandomIterator2, class OutputIterator, class BinaryOperation>
+        OutputIterator transform(RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, OutputIterator out, BinaryOperation operation, const options &option = options())
+        {
+            size_type length = last1 - first1;
+            _for_each_chunk(length, _grain_of(length, option), option, [&](size_type, size_type begin, size_type end) {
+                std::transform(first1 + begin, first1 + end, first2 + begin, out + begin, operation);
+            });
+            return out + length;
+        }
+
+        //operation은 결합법칙을 만족해야 합니다. chunk 결과는 순서대로 합치므로 교환법칙은 필요 없습니다.
+        template <class RandomIterator, class T, class BinaryOperation>
+        T reduce(RandomIterator first, RandomIterator last, T init, BinaryOperation operation, const options &option = options())
+        {
+            size_type length = last - first;
+            size_type grain = _grain_of(length, option);
+            fixed_vector<T> partial((length + grain - 1) / grain, for_overwrite);
+
+            _for_each_chunk(length, grain, option, [&](size_type chunk, size_type begin, size_type end) {
+                T sum = first[begin];
+                for (size_type i = begin + 1; i < end; i++)
+                    sum = operation(std::move(sum), first[i]);
+                partial[chunk] = std::move(sum);
+            });
+
+            for (size_type i = 0; i < partial.size(); i++)
+                init = operation(std::move(init), partial[i]);
+            return init;
+        }
+        template <class RandomIterator, class T>
+        T reduce(RandomIterator first, RandomIterator last, T init)
+        {
+            return par::reduce(first, last, std::move(init), std::plus<T>());
+        }
+
+        //chunk 합 -> chunk 시작값 prefix -> chunk별 scan 의 세 단계로 계산합니다.
+        template <class RandomIterator, class OutputIterator, class BinaryOperation>
+        OutputIterator inclusive_scan(RandomIterator first, RandomIterator last, OutputIterator out, BinaryOperation operation, const options &option = options())
+        {
+            using value_type = typename std::iterator_traits<RandomIterator>::value_type;
+
+            size_type length = last - first;
+            size_type grain = _grain_of(length, option);
+            size_type chunk_count = (length + grain - 1) / grain;
+            if (chunk_count <= 1)
+                return std::partial_sum(first, last, out, operation);
+
+            //마지막 chunk의 합은 필요 없으므로 앞의 chunk_count - 1개(모두 꽉 찬 chunk)만 더합니다.
+            fixed_vector<value_type> carry(chunk_count, for_overwrite);
+            _for_each_chunk((chunk_count - 1) * grain, grain, option, [&](size_type chunk, size_type begin, size_type end) {
+                value_type sum = first[begin];
+                for (size_type i = begin + 1; i < end; i++)
+                    sum = operation(std::move(sum), first[i]);
+                carry[chunk + 1] = std::move(sum);
+            });
+            for (size_type i = 2; i < chunk_count; i++)
+                carry[i] = operation(carry[i - 1], carry[i]);
+
+            _for_each_chunk(length, grain, option, [&](size_type chunk, size_type begin, size_type end) {
+                value_type sum = chunk == 0 ? value_type(first[begin]) : operation(carry[chunk], first[begin]);
+                out[begin] = sum;
+                for (size_type i = begin + 1; i < end; i++)
+                {
+                    sum = operation(std::move(sum), first[i]);
+                    out[i] = sum;
+                }
+            });
+            return out + length;
+        }
+        template <class RandomIterator, class OutputIterator>
+        OutputIterator inclusive_scan(RandomIterator first, RandomIterator last, OutputIterator out)
+        {
+            using value_type = typename std::iterator_traits<RandomIterator>::value_type;
+            return par::inclusive_scan(first, last, out, std::plus<value_type>());
+        }
+
+        //parallel sample sort입니다. 표본에서 고른 splitter로 bucket을 나누고, bucket마다 따로 정렬합니다.
+        //같은 값이 많이 몰리면 해당 bucket은 한 thread가 정렬합니다. 안정 정렬이 아닙니다.
+        template <class RandomIterator, class Compare>
+        void sort(RandomIterator first, RandomIterator last, Compare compare, const options &option = options())
+        {
+            using value_type = typename std::iterator_traits<RandomIterator>::value_type;
+
+            size_type length = last - first;
+            size_type grain = option.grain != 0 ? option.grain : _grain_of(length, option) * 4;
+            size_type bucket_count = std::min((length + grain - 1) / grain, (_pool_of(option).size() + 1) * 4);
+            if (bucket_count < 2)
+            {
+                std::sort(first, last, compare);
+                return;
+            }
+
+            //일정 간격 표본을 정렬해 bucket 경계를 고릅니다.
+            const size_type oversample = 32;
+            std::vector<value_type> sample;
+            sample.reserve(bucket_count * oversample);
+            for (size_type i = 0; i < bucket_count * oversample; i++)
+                sample.push_back(first[i * (length / (bucket_count * oversample))]);
+            std::sort(sample.begin(), sample.end(), compare);
+
+            std::vector<value_type> splitters;
+            splitters.reserve(bucket_count - 1);
+            for (size_type i = 1; i < bucket_count; i++)
+                splitters.push_back(sample[i * oversample]);
+
+            auto bucket_of = [&](const value_type &value) {
+                return static_cast<size_type>(std::upper_bound(splitters.begin(), splitters.end(), value, compare) - splitters.begin());
+            };
+
+            //chunk마다 bucket별 개수를 셉니다.
+            size_type chunk_grain = _grain_of(length, option);
+            size_type chunk_count = (length + chunk_grain - 1) / chunk_grain;
+            fixed_vector<size_type> offsets(chunk_count * bucket_count, size_type(0));
+
+            _for_each_chunk(length, chunk_grain, option, [&](size_type chunk, size_type begin, size_type end) {
+                size_type *count = offsets.data() + chunk * bucket_count;
+                for (size_type i = begin; i < end; i++)
+                    count[bucket_of(first[i])]++;
+            });
+
+            //bucket 순서, 그 안에서 chunk 순서로 쓰기 시작 위치를 정합니다.
+            fixed_vector<size_type> bucket_begin(bucket_count + 1, size_type(0));
+            size_type position = 0;
+            for (size_type bucket = 0; bucket < bucket_count; bucket++)
+            {
+                bucket_begin[bucket] = position;
+                for (size_type chunk = 0; chunk < chunk_count; chunk++)
+                {
+                    size_type count = offsets[chunk * bucket_count + bucket];
+                    offsets[chunk * bucket_count + bucket] = position;
+                    position += count;
+                }
+            }
+            bucket_begin[bucket_count] = length;
+
+            fixed_vector<value_type> buffer(length, for_overwrite);
+            _for_each_chunk(length, chunk_grain, option, [&](size_type chunk, size_type begin, size_type end) {
+                size_type *offset = offsets.data() + chunk * bucket_count;
+                for (size_type i = begin; i < end; i++)
+                    buffer[offset[bucket_of(first[i])]++] = std::move(first[i]);
+            });
+
+            _for_each_chunk(bucket_count, 1, option, [&](size_type bucket, size_type, size_type) {
+                value_type *begin = buffer.data() + bucket_begin[bucket];
+                value_type *end = buffer.data() + bucket_begin[bucket + 1];
+                std::sort(begin, end, compare);
+                std::move(begin, end, first + bucket_begin[bucket]);
+            });
+        }
+        template <class RandomIterator>
+        void sort(RandomIterator first, RandomIterator last)
+        {
+            using value_type = typename std::iterator_traits<RandomIterator>::value_type;
+            par::sort(first, last, std::less<value_type>());
+        }
+
+        //fixed_vector overload
+        template <class T, class Allocation, class U>
+        void fill(fixed_vector<T, Allocation> &vector, const U &value, const options &option = options())
+        {
+            par::fill(vector.data(), vector.data() + vector.size(), value, option);
+        }
+        template <class T, class Allocation, class U, class UnaryOperation>
+        void transform(const fixed_vector<T, Allocation> &source, fixed_vector<U, Allocation> &destination, UnaryOperation operation, const options &option = options())
+        {
+            par::transform(source.data(), source.data() + std::min(source.size(), destination.size()), destination.data(), operation, option);
+        }
+        template <class T, class Allocation, class U, class BinaryOperation>
+        U reduce(const fixed_vector<T, Allocation> &vector, U init, BinaryOperation operation, const options &option = options())
+        {
+            return par::reduce(vector.data(), vector.data() + vector.size(), std::move(init), operation, option);
+        }
+        template <class T, class Allocation, class BinaryOperation>
+        void inclusive_scan(const fixed_vector<T, Allocation> &source, fixed_vector<T, Allocation> &destination, BinaryOperation operation, const options &option = options())
+        {
+            par::inclusive_scan(source.data(), source.data() + std::min(source.size(), destination.size()), destination.data(), operation, option);
+        }
+        template <class T, class Allocation, class Compare>
+        void sort(fixed_vector<T, Allocation> &vector, Compare compare, const options &option = options())
+        {
+            par::sort(vector.data(), vector.data() + vector.size(), compare, option);
+        }
+        template <class T, class Allocation>
+        void sort(fixed_vector<T, Allocation> &vector)
+        {
+            par::sort(vector.data(), vector.data() + vector.size(), std::less<T>());
+        }
+    } // namespace par
+} // namespace xstl
+
+#endif
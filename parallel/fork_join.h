@@ -0,0 +1,59 @@
+#ifndef __XSTL_FORK_JOIN__
+#define __XSTL_FORK_JOIN__
+
+/*
+    Fork/Join Helpers on xstl::thread_pool.
+    fork_join runs two functions in parallel. parallel_for splits an index range in halves
+    until it reaches the grain size, so idle workers steal the biggest remaining pieces.
+*/
+
+#include <cstddef>
+#include "./thread_pool.h"
+
+namespace xstl
+{
+    //right를 pool에 넘기고 left는 현재 thread에서 실행한 뒤, 둘 다 끝날 때까지 기다립니다.
+    //기다리는 동안 다른 작업을 대신 실행하므로 worker 안에서 중첩해도 됩니다.
+    template <class Left, class Right>
+    void fork_join(thread_pool &pool, Left &&left, Right &&right)
+    {
+        task_group group(pool);
+        group.run(std::forward<Right>(right));
+        left();
+        group.wait();
+    }
+    template <class Left, class Right>
+    void fork_join(Left &&left, Right &&right)
+    {
+        fork_join(thread_pool::default_pool(), std::forward<Left>(left), std::forward<Right>(right));
+    }
+
+    //[begin, end)를 grain 이하 구간으로 나눠 function(chunk_begin, chunk_end)를 병렬 실행합니다.
+    template <class Function>
+    void parallel_for(thread_pool &pool, std::size_t begin, std::size_t end, std::size_t grain, const Function &function)
+    {
+        if (grain == 0)
+            grain = 1;
+
+        if (end - begin <= grain)
+        {
+            if (begin < end)
+                function(begin, end);
+            return;
+        }
+
+        //오른쪽 절반은 다른 worker가 훔쳐 가고, 왼쪽 절반은 계속 나눕니다.
+        std::size_t middle = begin + (end - begin) / 2;
+        fork_join(
+            pool,
+            [&pool, begin, middle, grain, &function] { parallel_for(pool, begin, middle, grain, function); },
+            [&pool, middle, end, grain, &function] { parallel_for(pool, middle, end, grain, function); });
+    }
+    template <class Function>
+    void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, const Function &function)
+    {
+        parallel_for(thread_pool::default_pool(), begin, end, grain, function);
+    }
+} // namespace xstl
+
+#endif
@@ -0,0 +1,430 @@
+#ifndef __XSTL_THREAD_POOL__
+#define __XSTL_THREAD_POOL__
+
+/*
+    Work-Stealing Thread Pool.
+    Every worker owns a lock-free Chase-Lev deque. It pops its own tasks LIFO and steals other workers' tasks FIFO.
+    Threads outside the pool submit into a shared injection queue.
+    fork_join / parallel_for helpers are in fork_join.h.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../array/fixed_vector.h"
+
+#if defined(__linux__)
+#include <pthread.h> //pthread_setaffinity_np
+#include <sched.h>
+#endif
+
+namespace xstl
+{
+    //Chase-Lev work-stealing deque입니다.
+    //owner thread만 push/pop(bottom 쪽)하고, 다른 thread는 steal(top 쪽)만 합니다.
+    template <class T>
+    class work_stealing_deque
+    {
+    public:
+        using Self = work_stealing_deque;
+        using value_type = T *;
+        using size_type = std::size_t;
+
+    private:
+        struct _ring
+        {
+            std::int64_t capacity;
+            std::unique_ptr<std::atomic<value_type>[]> slots;
+
+            explicit _ring(std::int64_t _capacity) : capacity(_capacity), slots(new std::atomic<value_type>[_capacity])
+            {
+            }
+            value_type get(std::int64_t index) const
+            {
+                return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+            }
+            void put(std::int64_t index, value_type value)
+            {
+                slots[index & (capacity - 1)].store(value, std::memory_order_relaxed);
+            }
+        };
+
+    private:
+        alignas(64) std::atomic<std::int64_t> _top{0};
+        alignas(64) std::atomic<std::int64_t> _bottom{0};
+        std::atomic<_ring *> _array;
+        //steal 중인 thread가 옛 배열을 읽고 있을 수 있으므로 deque가 사라질 때까지 보관합니다.
+        std::vector<std::unique_ptr<_ring>> _rings;
+
+    private:
+        _ring *_grow(_ring *ring, std::int64_t top, std::int64_t bottom)
+        {
+            std::unique_ptr<_ring> bigger(new _ring(ring->capacity * 2));
+            for (std::int64_t i = top; i < bottom; i++)
+                bigger->put(i, ring->get(i));
+
+            _ring *result = bigger.get();
+            this->_rings.push_back(std::move(bigger));
+            this->_array.store(result, std::memory_order_release);
+            return result;
+        }
+
+    public:
+        explicit work_stealing_deque(size_type capacity = 256)
+        {
+            std::int64_t rounded = 1;
+            while (rounded < static_cast<std::int64_t>(capacity))
+                rounded <<= 1;
+
+            this->_rings.emplace_back(new _ring(rounded));
+            this->_array.store(this->_rings.back().get(), std::memory_order_relaxed);
+        }
+
+    public:
+        work_stealing_deque(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public:
+        //owner 전용
+        void push(value_type value)
+        {
+            std::int64_t bottom = this->_bottom.load(std::memory_order_relaxed);
+            std::int64_t top = this->_top.load(std::memory_order_acquire);
+            _ring *ring = this->_array.load(std::memory_order_relaxed);
+
+            if (bottom - top > ring->capacity - 1)
+                ring = this->_grow(ring, top, bottom);
+
+            ring->put(bottom, value);
+            this->_bottom.store(bottom + 1, std::memory_order_release);
+        }
+
+        //owner 전용. 비어 있으면 nullptr입니다.
+        value_type pop()
+        {
+            std::int64_t bottom = this->_bottom.load(std::memory_order_relaxed) - 1;
+            _ring *ring = this->_array.load(std::memory_order_relaxed);
+            this->_bottom.store(bottom, std::memory_order_seq_cst);
+            std::int64_t top = this->_top.load(std::memory_order_seq_cst);
+
+            if (top > bottom)
+            {
+                this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            value_type value = ring->get(bottom);
+            if (top == bottom)
+            {
+                //마지막 하나는 steal과 경쟁합니다.
+                if (!this->_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    value = nullptr;
+                this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return value;
+        }
+
+        //아무 thread나 호출할 수 있습니다. 비었거나 경쟁에서 지면 nullptr입니다.
+        value_type steal()
+        {
+            std::int64_t top = this->_top.load(std::memory_order_seq_cst);
+            std::int64_t bottom = this->_bottom.load(std::memory_order_seq_cst);
+            if (top >= bottom)
+                return nullptr;
+
+            _ring *ring = this->_array.load(std::memory_order_acquire);
+            value_type value = ring->get(top);
+            if (!this->_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+            return value;
+        }
+
+        bool empty() const noexcept
+        {
+            return this->_top.load(std::memory_order_relaxed) >= this->_bottom.load(std::memory_order_relaxed);
+        }
+    };
+
+    class thread_pool
+    {
+    public:
+        using Self = thread_pool;
+        using size_type = std::size_t;
+        using task_type = std::function<void()>;
+
+    private:
+        //외부 thread가 제출하는 큐입니다. 여러 thread가 넣으므로 lock을 씁니다.
+        struct alignas(64) _injection_queue
+        {
+            std::mutex lock;
+            std::deque<task_type *> tasks;
+        };
+
+        //현재 thread가 어느 pool의 몇 번째 worker인지 기록합니다.
+        struct _worker_context
+        {
+            const thread_pool *pool = nullptr;
+            size_type index = 0;
+        };
+        static _worker_context &_context()
+        {
+            static thread_local _worker_context context;
+            return context;
+        }
+
+    private:
+        std::vector<std::thread> _threads;
+        //deque는 alignas(64) 멤버를 가지므로 C++11의 new[] 대신 정렬된 할당을 씁니다.
+        fixed_vector<work_stealing_deque<task_type>, aligned_allocation<64>> _deques;
+        _injection_queue _injection;
+        size_type _thread_count = 0;
+
+        alignas(64) std::atomic<size_type> _queued{0};
+        std::atomic<size_type> _sleeping{0};
+        std::atomic<bool> _stop{false};
+        std::mutex _sleep_lock;
+        std::condition_variable _sleep;
+
+    private:
+        task_type *_pop_injection()
+        {
+            std::lock_guard<std::mutex> guard(this->_injection.lock);
+            if (this->_injection.tasks.empty())
+                return nullptr;
+
+            task_type *task = this->_injection.tasks.front();
+            this->_injection.tasks.pop_front();
+            return task;
+        }
+
+        //자기 deque -> 외부 제출 큐 -> 다른 worker 순으로 일을 찾습니다.
+        task_type *_find_task()
+        {
+            _worker_context &context = _context();
+            bool is_worker = context.pool == this;
+            size_type self = is_worker ? context.index : 0;
+
+            task_type *task = nullptr;
+            if (is_worker && (task = this->_deques[self].pop()) != nullptr)
+                return task;
+            if ((task = this->_pop_injection()) != nullptr)
+                return task;
+
+            for (size_type i = 0; i < this->_thread_count; i++)
+            {
+                size_type victim = (self + i + 1) % this->_thread_count;
+                if (is_worker && victim == self)
+                    continue;
+                if ((task = this->_deques[victim].steal()) != nullptr)
+                    return task;
+            }
+            return nullptr;
+        }
+
+        void _wake_one()
+        {
+            //_queued 증가 뒤에 _sleeping을 읽으므로, 잠들려는 worker는 둘 중 하나를 반드시 봅니다.
+            if (this->_sleeping.load() == 0)
+                return;
+
+            {
+                std::lock_guard<std::mutex> guard(this->_sleep_lock);
+            }
+            this->_sleep.notify_one();
+        }
+
+        void _worker_loop(size_type index)
+        {
+            _context().pool = this;
+            _context().index = index;
+
+            while (true)
+            {
+                if (this->run_pending_task())
+                    continue;
+
+                std::unique_lock<std::mutex> lock(this->_sleep_lock);
+                this->_sleeping.fetch_add(1);
+                this->_sleep.wait(lock, [this] { return this->_stop.load() || this->_queued.load() > 0; });
+                this->_sleeping.fetch_sub(1);
+
+                if (this->_stop.load() && this->_queued.load() == 0)
+                    return;
+            }
+        }
+
+        //worker를 CPU 하나에 고정합니다. Linux 이외에서는 아무것도 하지 않습니다.
+        static void _pin(std::thread &thread, size_type index)
+        {
+#if defined(__linux__)
+            unsigned cpu_count = std::thread::hardware_concurrency();
+            if (cpu_count == 0)
+                return;
+
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            CPU_SET(index % cpu_count, &cpu_set);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set);
+#else
+            (void)thread;
+            (void)index;
+#endif
+        }
+
+    public:
+        explicit thread_pool(size_type thread_count = std::thread::hardware_concurrency(), bool pin_threads = false)
+            : _deques(thread_count == 0 ? 1 : thread_count, for_overwrite),
+              _thread_count(thread_count == 0 ? 1 : thread_count)
+        {
+            this->_threads.reserve(this->_thread_count);
+            for (size_type i = 0; i < this->_thread_count; i++)
+            {
+                this->_threads.emplace_back(&thread_pool::_worker_loop, this, i);
+                if (pin_threads)
+                    _pin(this->_threads.back(), i);
+            }
+        }
+        //남은 작업을 모두 처리한 뒤 종료합니다.
+        ~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> guard(this->_sleep_lock);
+                this->_stop.store(true);
+            }
+            this->_sleep.notify_all();
+
+            for (auto &thread : this->_threads)
+                thread.join();
+        }
+
+    public:
+        thread_pool(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public:
+        //hardware_concurrency 크기의 공용 pool입니다.
+        static thread_pool &default_pool()
+        {
+            static thread_pool pool;
+            return pool;
+        }
+
+        size_type size() const noexcept
+        {
+            return this->_thread_count;
+        }
+
+        //worker thread에서 호출하면 자기 deque에 lock 없이, 아니면 외부 제출 큐에 넣습니다.
+        template <class Function>
+        void submit(Function &&function)
+        {
+            task_type *task = new task_type(std::forward<Function>(function));
+
+            _worker_context &context = _context();
+            if (context.pool == this)
+                this->_deques[context.index].push(task);
+            else
+            {
+                std::lock_guard<std::mutex> guard(this->_injection.lock);
+                this->_injection.tasks.push_back(task);
+            }
+
+            this->_queued.fetch_add(1);
+            this->_wake_one();
+        }
+
+        //대기 중인 작업 하나를 현재 thread에서 실행합니다. 실행할 작업이 없으면 false입니다.
+        bool run_pending_task()
+        {
+            std::unique_ptr<task_type> task(this->_find_task());
+            if (!task)
+                return false;
+
+            this->_queued.fetch_sub(1);
+            (*task)();
+            return true;
+        }
+    };
+
+    //여러 작업을 pool에 나눠 넣고 모두 끝날 때까지 기다립니다.
+    //wait()는 기다리는 동안 다른 작업을 대신 실행하므로 worker 안에서 중첩해도 멈추지 않습니다.
+    class task_group
+    {
+    public:
+        using Self = task_group;
+
+    private:
+        thread_pool &_pool;
+        std::atomic<std::size_t> _pending{0};
+        std::exception_ptr _error;
+        std::mutex _error_lock;
+
+    public:
+        explicit task_group(thread_pool &pool = thread_pool::default_pool()) : _pool(pool)
+        {
+        }
+        ~task_group()
+        {
+            while (this->_pending.load() > 0)
+                if (!this->_pool.run_pending_task())
+                    std::this_thread::yield();
+        }
+
+    public:
+        task_group(const Self &) = delete;
+        Self &operator=(const Self &) = delete;
+
+    public:
+        template <class Function>
+        void run(Function &&function)
+        {
+            typename std::decay<Function>::type task(std::forward<Function>(function));
+
+            this->_pending.fetch_add(1);
+            this->_pool.submit([this, task]() mutable {
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> guard(this->_error_lock);
+                    if (!this->_error)
+                        this->_error = std::current_exception();
+                }
+                this->_pending.fetch_sub(1);
+            });
+        }
+
+        //작업 중 처음 발생한 예외를 다시 던집니다.
+        void wait()
+        {
+            while (this->_pending.load() > 0)
+                if (!this->_pool.run_pending_task())
+                    std::this_thread::yield();
+
+            if (this->_error)
+            {
+                std::exception_ptr error = this->_error;
+                this->_error = nullptr;
+                std::rethrow_exception(error);
+            }
+        }
+
+        thread_pool &pool() noexcept
+        {
+            return this->_pool;
+        }
+    };
+} // namespace xstl
+
+#endif
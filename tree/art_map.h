@@ -0,0 +1,1393 @@
+#ifndef __XSTL_ART_MAP__
+#define __XSTL_ART_MAP__
+
+/*
+    Adaptive Radix Tree Map (Leis et al.).
+    KeyTraits turns a key into a byte string whose byte order is the key order (big-endian for integers).
+    Inner nodes grow and shrink through Node4/16/48/256 and hold a compressed path prefix. Only the first
+    _max_prefix bytes are stored in the node; longer prefixes are checked against a leaf (hybrid compression).
+    A key that ends at an inner node lives in that node's terminal slot, so keys do not have to be prefix-free.
+    Leaves are chained in key order, so iteration and prefix scans never walk back up the tree.
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../utility/bit_operation.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define __XSTL_ART_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace xstl
+{
+    //key를 byte 열로 본 것입니다. 정수처럼 짧은 key는 안에 복사하고, 문자열은 원본을 가리킵니다.
+    class art_key_bytes
+    {
+    private:
+        const unsigned char *_external = nullptr;
+        std::size_t _size = 0;
+        unsigned char _inline[16];
+
+    public:
+        static art_key_bytes view(const void *data, std::size_t size) noexcept
+        {
+            art_key_bytes bytes;
+            bytes._external = static_cast<const unsigned char *>(data);
+            bytes._size = size;
+            return bytes;
+        }
+        static art_key_bytes copy(const void *data, std::size_t size) noexcept
+        {
+            art_key_bytes bytes;
+            assert(size <= sizeof(bytes._inline));
+            std::memcpy(bytes._inline, data, size);
+            bytes._size = size;
+            return bytes;
+        }
+
+        const unsigned char *data() const noexcept
+        {
+            return this->_external != nullptr ? this->_external : this->_inline;
+        }
+        std::size_t size() const noexcept
+        {
+            return this->_size;
+        }
+        unsigned char operator[](std::size_t index) const noexcept
+        {
+            return this->data()[index];
+        }
+        //앞의 size byte만 남깁니다.
+        void truncate(std::size_t size) noexcept
+        {
+            assert(size <= this->_size);
+            this->_size = size;
+        }
+
+        //사전순 비교입니다. (unsigned byte 기준)
+        friend int compare(const art_key_bytes &left, const art_key_bytes &right) noexcept
+        {
+            std::size_t common = left._size < right._size ? left._size : right._size;
+            int result = common == 0 ? 0 : std::memcmp(left.data(), right.data(), common);
+            if (result != 0)
+                return result;
+            return left._size < right._size ? -1 : (left._size > right._size ? 1 : 0);
+        }
+    };
+
+    //정수는 big-endian으로, 부호 있는 정수는 부호 bit를 뒤집어 음수가 먼저 오게 합니다.
+    template <class Key, class = void>
+    struct art_key_traits;
+
+    template <class Key>
+    struct art_key_traits<Key, typename std::enable_if<std::is_integral<Key>::value && !std::is_same<Key, bool>::value>::type>
+    {
+        static art_key_bytes encode(Key key) noexcept
+        {
+            using unsigned_type = typename std::make_unsigned<Key>::type;
+            unsigned_type value = static_cast<unsigned_type>(key);
+            if (std::is_signed<Key>::value)
+                value = static_cast<unsigned_type>(value ^ (static_cast<unsigned_type>(1) << (sizeof(Key) * 8 - 1)));
+
+            unsigned char bytes[sizeof(Key)];
+            for (std::size_t i = sizeof(Key); i-- > 0;)
+            {
+                bytes[i] = static_cast<unsigned char>(value & 0xff);
+                value = static_cast<unsigned_type>(value >> 4 >> 4);
+            }
+            return art_key_bytes::copy(bytes, sizeof(Key));
+        }
+    };
+
+    template <>
+    struct art_key_traits<std::string, void>
+    {
+        static art_key_bytes encode(const std::string &key) noexcept
+        {
+            return art_key_bytes::view(key.data(), key.size());
+        }
+    };
+
+    template <class Key, class V, class KeyTraits = art_key_traits<Key>>
+    class art_map
+    {
+    public:
+        using Self = art_map;
+
+    public: //stl standard type member
+        using key_type = Key;
+        using mapped_type = V;
+        using value_type = std::pair<const Key, V>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using key_traits = KeyTraits;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        class iterator;
+        class const_iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        template <class Iterator>
+        class basic_range;
+        using range_type = basic_range<iterator>;
+        using const_range_type = basic_range<const_iterator>;
+
+    private:
+        static constexpr std::size_t _max_prefix = 8;
+
+        enum _node_kind : std::uint8_t
+        {
+            _kind4,
+            _kind16,
+            _kind48,
+            _kind256
+        };
+
+        struct _leaf
+        {
+            _leaf *prev = nullptr; //key 순서의 이전/다음 leaf
+            _leaf *next = nullptr;
+            value_type value;
+
+            template <class K, class... Args>
+            explicit _leaf(K &&key, Args &&... args)
+                : value(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...))
+            {
+            }
+        };
+
+        //자식 포인터의 최하위 bit가 1이면 leaf입니다.
+        struct _node
+        {
+            _node_kind kind;
+            std::uint16_t count = 0;          //자식 수
+            std::uint32_t prefix_length = 0;  //압축된 경로 길이
+            unsigned char prefix[_max_prefix]; //그중 앞부분
+            _leaf *terminal = nullptr;         //경로가 정확히 여기서 끝나는 key
+
+            explicit _node(_node_kind _kind) : kind(_kind)
+            {
+            }
+        };
+        struct _node4 : _node
+        {
+            unsigned char keys[4];
+            _node *children[4];
+
+            _node4() : _node(_kind4)
+            {
+            }
+        };
+        struct _node16 : _node
+        {
+            unsigned char keys[16];
+            _node *children[16];
+
+            _node16() : _node(_kind16)
+            {
+            }
+        };
+        struct _node48 : _node
+        {
+            unsigned char index[256]; //byte -> children 위치 + 1, 0이면 없음
+            _node *children[48];
+
+            _node48() : _node(_kind48)
+            {
+                std::memset(this->index, 0, sizeof(this->index));
+                for (auto &child : this->children)
+                    child = nullptr;
+            }
+        };
+        struct _node256 : _node
+        {
+            _node *children[256];
+
+            _node256() : _node(_kind256)
+            {
+                for (auto &child : this->children)
+                    child = nullptr;
+            }
+        };
+
+        _node *_root = nullptr;
+        _leaf *_head = nullptr;
+        _leaf *_tail = nullptr;
+        size_type _size = 0;
+
+    private: //leaf
+        static bool _is_leaf(const _node *node) noexcept
+        {
+            return (reinterpret_cast<std::uintptr_t>(node) & 1) != 0;
+        }
+        static _leaf *_as_leaf(const _node *node) noexcept
+        {
+            return reinterpret_cast<_leaf *>(reinterpret_cast<std::uintptr_t>(node) & ~static_cast<std::uintptr_t>(1));
+        }
+        static _node *_tag(_leaf *leaf) noexcept
+        {
+            return reinterpret_cast<_node *>(reinterpret_cast<std::uintptr_t>(leaf) | 1);
+        }
+        static art_key_bytes _bytes_of(const _leaf *leaf) noexcept
+        {
+            return KeyTraits::encode(leaf->value.first);
+        }
+
+        //after 앞에 끼웁니다. after가 nullptr이면 맨 뒤입니다.
+        void _link_leaf(_leaf *leaf, _leaf *after) noexcept
+        {
+            leaf->next = after;
+            leaf->prev = after != nullptr ? after->prev : this->_tail;
+            (leaf->prev != nullptr ? leaf->prev->next : this->_head) = leaf;
+            (after != nullptr ? after->prev : this->_tail) = leaf;
+        }
+        void _unlink_leaf(_leaf *leaf) noexcept
+        {
+            (leaf->prev != nullptr ? leaf->prev->next : this->_head) = leaf->next;
+            (leaf->next != nullptr ? leaf->next->prev : this->_tail) = leaf->prev;
+        }
+
+    private: //node
+        static void _free_node(_node *node) noexcept
+        {
+            switch (node->kind)
+            {
+            case _kind4:
+                delete static_cast<_node4 *>(node);
+                break;
+            case _kind16:
+                delete static_cast<_node16 *>(node);
+                break;
+            case _kind48:
+                delete static_cast<_node48 *>(node);
+                break;
+            default:
+                delete static_cast<_node256 *>(node);
+                break;
+            }
+        }
+        //leaf는 list로 따로 지우므로 inner node만 지웁니다.
+        static void _free_tree(_node *node) noexcept
+        {
+            if (node == nullptr || _is_leaf(node))
+                return;
+            int byte = -1;
+            while (_node *child = _child_after(node, byte, &byte))
+                _free_tree(child);
+            _free_node(node);
+        }
+        static void _copy_header(_node *to, const _node *from) noexcept
+        {
+            to->count = from->count;
+            to->prefix_length = from->prefix_length;
+            std::memcpy(to->prefix, from->prefix, _max_prefix);
+            to->terminal = from->terminal;
+        }
+
+        static _node **_find_child(_node *node, unsigned char byte) noexcept
+        {
+            switch (node->kind)
+            {
+            case _kind4:
+            {
+                _node4 *n = static_cast<_node4 *>(node);
+                for (unsigned i = 0; i < n->count; i++)
+                    if (n->keys[i] == byte)
+                        return &n->children[i];
+                return nullptr;
+            }
+            case _kind16:
+            {
+                _node16 *n = static_cast<_node16 *>(node);
+#if defined(__XSTL_ART_SSE2)
+                //16개 key를 한 번에 비교합니다.
+                __m128i match = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys)));
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(match)) & ((1u << n->count) - 1);
+                return mask != 0 ? &n->children[_count_trailing_zero64(mask)] : nullptr;
+#else
+                for (unsigned i = 0; i < n->count; i++)
+                    if (n->keys[i] == byte)
+                        return &n->children[i];
+                return nullptr;
+#endif
+            }
+            case _kind48:
+            {
+                _node48 *n = static_cast<_node48 *>(node);
+                return n->index[byte] != 0 ? &n->children[n->index[byte] - 1] : nullptr;
+            }
+            default:
+            {
+                _node256 *n = static_cast<_node256 *>(node);
+                return n->children[byte] != nullptr ? &n->children[byte] : nullptr;
+            }
+            }
+        }
+
+        //byte가 after보다 큰 첫 자식입니다. (after = -1이면 첫 자식)
+        static _node *_child_after(const _node *node, int after, int *found_byte = nullptr) noexcept
+        {
+            int byte = -1;
+            _node *child = nullptr;
+            switch (node->kind)
+            {
+            case _kind4:
+            case _kind16:
+            {
+                const unsigned char *keys = node->kind == _kind4 ? static_cast<const _node4 *>(node)->keys : static_cast<const _node16 *>(node)->keys;
+                _node *const *children = node->kind == _kind4 ? static_cast<const _node4 *>(node)->children : static_cast<const _node16 *>(node)->children;
+                for (unsigned i = 0; i < node->count; i++)
+                    if (keys[i] > after)
+                    {
+                        byte = keys[i];
+                        child = children[i];
+                        break;
+                    }
+                break;
+            }
+            case _kind48:
+            {
+                const _node48 *n = static_cast<const _node48 *>(node);
+                for (int b = after + 1; b < 256; b++)
+                    if (n->index[b] != 0)
+                    {
+                        byte = b;
+                        child = n->children[n->index[b] - 1];
+                        break;
+                    }
+                break;
+            }
+            default:
+            {
+                const _node256 *n = static_cast<const _node256 *>(node);
+                for (int b = after + 1; b < 256; b++)
+                    if (n->children[b] != nullptr)
+                    {
+                        byte = b;
+                        child = n->children[b];
+                        break;
+                    }
+                break;
+            }
+            }
+            if (found_byte != nullptr)
+                *found_byte = byte;
+            return child;
+        }
+        //byte가 가장 큰 자식입니다.
+        static _node *_last_child(const _node *node) noexcept
+        {
+            switch (node->kind)
+            {
+            case _kind4:
+                return node->count == 0 ? nullptr : static_cast<const _node4 *>(node)->children[node->count - 1];
+            case _kind16:
+                return node->count == 0 ? nullptr : static_cast<const _node16 *>(node)->children[node->count - 1];
+            case _kind48:
+            {
+                const _node48 *n = static_cast<const _node48 *>(node);
+                for (int b = 255; b >= 0; b--)
+                    if (n->index[b] != 0)
+                        return n->children[n->index[b] - 1];
+                return nullptr;
+            }
+            default:
+            {
+                const _node256 *n = static_cast<const _node256 *>(node);
+                for (int b = 255; b >= 0; b--)
+                    if (n->children[b] != nullptr)
+                        return n->children[b];
+                return nullptr;
+            }
+            }
+        }
+
+        static _leaf *_minimum_leaf(const _node *node) noexcept
+        {
+            while (!_is_leaf(node))
+            {
+                if (node->terminal != nullptr)
+                    return node->terminal;
+                node = _child_after(node, -1);
+            }
+            return _as_leaf(node);
+        }
+        static _leaf *_maximum_leaf(const _node *node) noexcept
+        {
+            while (!_is_leaf(node))
+            {
+                _node *child = _last_child(node);
+                if (child == nullptr)
+                    return node->terminal;
+                node = child;
+            }
+            return _as_leaf(node);
+        }
+
+        template <class Keys, class Children>
+        static void _insert_sorted(Keys &keys, Children &children, std::uint16_t &count, unsigned char byte, _node *child) noexcept
+        {
+            unsigned i = count;
+            for (; i > 0 && keys[i - 1] > byte; i--)
+            {
+                keys[i] = keys[i - 1];
+                children[i] = children[i - 1];
+            }
+            keys[i] = byte;
+            children[i] = child;
+            count++;
+        }
+
+        //자리가 없으면 한 단계 큰 node로 바꿉니다. 새 node를 먼저 할당하므로 실패해도 트리는 그대로입니다.
+        static void _add_child(_node **slot, unsigned char byte, _node *child)
+        {
+            _node *node = *slot;
+            switch (node->kind)
+            {
+            case _kind4:
+            {
+                _node4 *n = static_cast<_node4 *>(node);
+                if (n->count < 4)
+                    return _insert_sorted(n->keys, n->children, n->count, byte, child);
+                _node16 *grown = new _node16();
+                _copy_header(grown, n);
+                std::memcpy(grown->keys, n->keys, 4);
+                std::memcpy(grown->children, n->children, 4 * sizeof(_node *));
+                delete n;
+                *slot = grown;
+                return _insert_sorted(grown->keys, grown->children, grown->count, byte, child);
+            }
+            case _kind16:
+            {
+                _node16 *n = static_cast<_node16 *>(node);
+                if (n->count < 16)
+                    return _insert_sorted(n->keys, n->children, n->count, byte, child);
+                _node48 *grown = new _node48();
+                _copy_header(grown, n);
+                for (unsigned i = 0; i < 16; i++)
+                {
+                    grown->index[n->keys[i]] = static_cast<unsigned char>(i + 1);
+                    grown->children[i] = n->children[i];
+                }
+                delete n;
+                *slot = grown;
+                node = grown;
+            }
+            //fall through
+            case _kind48:
+            {
+                _node48 *n = static_cast<_node48 *>(node);
+                if (n->count < 48)
+                {
+                    unsigned position = 0;
+                    while (n->children[position] != nullptr)
+                        position++;
+                    n->children[position] = child;
+                    n->index[byte] = static_cast<unsigned char>(position + 1);
+                    n->count++;
+                    return;
+                }
+                _node256 *grown = new _node256();
+                _copy_header(grown, n);
+                for (unsigned b = 0; b < 256; b++)
+                    if (n->index[b] != 0)
+                        grown->children[b] = n->children[n->index[b] - 1];
+                delete n;
+                *slot = grown;
+                node = grown;
+            }
+            //fall through
+            default:
+            {
+                _node256 *n = static_cast<_node256 *>(node);
+                n->children[byte] = child;
+                n->count++;
+                return;
+            }
+            }
+        }
+
+        static void _remove_child(_node *node, unsigned char byte) noexcept
+        {
+            switch (node->kind)
+            {
+            case _kind4:
+            case _kind16:
+            {
+                unsigned char *keys = node->kind == _kind4 ? static_cast<_node4 *>(node)->keys : static_cast<_node16 *>(node)->keys;
+                _node **children = node->kind == _kind4 ? static_cast<_node4 *>(node)->children : static_cast<_node16 *>(node)->children;
+                unsigned i = 0;
+                while (keys[i] != byte)
+                    i++;
+                for (; i + 1 < node->count; i++)
+                {
+                    keys[i] = keys[i + 1];
+                    children[i] = children[i + 1];
+                }
+                break;
+            }
+            case _kind48:
+            {
+                _node48 *n = static_cast<_node48 *>(node);
+                n->children[n->index[byte] - 1] = nullptr;
+                n->index[byte] = 0;
+                break;
+            }
+            default:
+                static_cast<_node256 *>(node)->children[byte] = nullptr;
+                break;
+            }
+            node->count--;
+        }
+
+    private: //prefix
+        //node 아래 아무 leaf나 key 전체를 가지므로, 저장되지 않은 prefix byte는 최소 leaf에서 읽습니다.
+        static unsigned char _prefix_byte(const _node *node, size_type index, size_type depth) noexcept
+        {
+            if (index < _max_prefix)
+                return node->prefix[index];
+            return _bytes_of(_minimum_leaf(node))[depth + index];
+        }
+        static void _load_prefix(_node *node, size_type depth) noexcept
+        {
+            art_key_bytes bytes = _bytes_of(_minimum_leaf(node));
+            size_type stored = node->prefix_length < _max_prefix ? node->prefix_length : _max_prefix;
+            std::memcpy(node->prefix, bytes.data() + depth, stored);
+        }
+        //node의 prefix가 key[depth..]와 몇 byte 일치하는지 셉니다. key가 먼저 끝나면 거기서 멈춥니다.
+        static size_type _prefix_match(const _node *node, const art_key_bytes &key, size_type depth) noexcept
+        {
+            size_type limit = key.size() - depth < node->prefix_length ? key.size() - depth : node->prefix_length;
+            size_type stored = limit < _max_prefix ? limit : _max_prefix;
+            size_type i = 0;
+            for (; i < stored; i++)
+                if (node->prefix[i] != key[depth + i])
+                    return i;
+            if (i < limit)
+            {
+                art_key_bytes bytes = _bytes_of(_minimum_leaf(node));
+                for (; i < limit; i++)
+                    if (bytes[depth + i] != key[depth + i])
+                        return i;
+            }
+            return i;
+        }
+
+    private: //search
+        _leaf *_find_leaf(const art_key_bytes &key) const noexcept
+        {
+            _node *node = this->_root;
+            size_type depth = 0;
+            while (node != nullptr && !_is_leaf(node))
+            {
+                //저장된 prefix만 비교하고 나머지는 leaf에서 한 번에 확인합니다. (optimistic)
+                if (key.size() - depth < node->prefix_length)
+                    return nullptr;
+                size_type stored = node->prefix_length < _max_prefix ? node->prefix_length : _max_prefix;
+                if (stored != 0 && std::memcmp(node->prefix, key.data() + depth, stored) != 0)
+                    return nullptr;
+                depth += node->prefix_length;
+                if (depth == key.size())
+                {
+                    _leaf *leaf = node->terminal;
+                    return leaf != nullptr && compare(_bytes_of(leaf), key) == 0 ? leaf : nullptr;
+                }
+                _node **child = _find_child(node, key[depth]);
+                if (child == nullptr)
+                    return nullptr;
+                node = *child;
+                depth++;
+            }
+            if (node == nullptr)
+                return nullptr;
+            _leaf *leaf = _as_leaf(node);
+            return compare(_bytes_of(leaf), key) == 0 ? leaf : nullptr;
+        }
+
+        //node 아래에서 key보다 작지 않은 첫 leaf입니다. 없으면 nullptr이고 호출자가 다음 형제로 넘어갑니다.
+        static _leaf *_lower_bound_leaf(const _node *node, const art_key_bytes &key, size_type depth) noexcept
+        {
+            if (node == nullptr)
+                return nullptr;
+            if (_is_leaf(node))
+            {
+                _leaf *leaf = _as_leaf(node);
+                return compare(_bytes_of(leaf), key) >= 0 ? leaf : nullptr;
+            }
+
+            size_type matched = _prefix_match(node, key, depth);
+            if (matched < node->prefix_length)
+            {
+                //key가 prefix 안에서 끝났거나 prefix가 더 크면 이 subtree 전체가 key보다 큽니다.
+                if (depth + matched == key.size() || _prefix_byte(node, matched, depth) > key[depth + matched])
+                    return _minimum_leaf(node);
+                return nullptr;
+            }
+            depth += node->prefix_length;
+            if (depth == key.size())
+                return _minimum_leaf(node);
+
+            //terminal은 key의 진짜 prefix이므로 key보다 작습니다.
+            unsigned char byte = key[depth];
+            _node **child = _find_child(const_cast<_node *>(node), byte);
+            if (child != nullptr)
+                if (_leaf *found = _lower_bound_leaf(*child, key, depth + 1))
+                    return found;
+            _node *next = _child_after(node, byte);
+            return next != nullptr ? _minimum_leaf(next) : nullptr;
+        }
+        _leaf *_lower_bound_leaf(const art_key_bytes &key) const noexcept
+        {
+            return _lower_bound_leaf(this->_root, key, 0);
+        }
+
+        //prefix로 시작하는 key들의 [first, last) leaf입니다.
+        std::pair<_leaf *, _leaf *> _prefix_bounds(const art_key_bytes &prefix) const
+        {
+            _leaf *first = this->_lower_bound_leaf(prefix);
+            //prefix 다음 문자열: 끝의 0xff를 떼고 마지막 byte를 1 올립니다.
+            std::string next(reinterpret_cast<const char *>(prefix.data()), prefix.size());
+            while (!next.empty() && static_cast<unsigned char>(next.back()) == 0xff)
+                next.pop_back();
+            if (next.empty())
+                return {first, nullptr};
+            next.back() = static_cast<char>(static_cast<unsigned char>(next.back()) + 1);
+            return {first, this->_lower_bound_leaf(art_key_bytes::view(next.data(), next.size()))};
+        }
+
+    private: //modify
+        template <class K, class... Args>
+        std::pair<_leaf *, bool> _try_emplace(K &&key_value, Args &&... args)
+        {
+            art_key_bytes key = KeyTraits::encode(key_value);
+            _leaf *leaf = nullptr;
+            //새 leaf가 필요할 때만 만듭니다. key가 옮겨지므로 그 전에 list에서 들어갈 자리를 찾아 둡니다.
+            auto make_leaf = [&]() {
+                _leaf *after = this->_lower_bound_leaf(key);
+                leaf = new _leaf(std::forward<K>(key_value), std::forward<Args>(args)...);
+                key = _bytes_of(leaf);
+                return after;
+            };
+
+            _node **slot = &this->_root;
+            size_type depth = 0;
+            _leaf *after = nullptr;
+            while (true)
+            {
+                _node *node = *slot;
+                if (node == nullptr)
+                {
+                    after = make_leaf();
+                    *slot = _tag(leaf);
+                    break;
+                }
+
+                if (_is_leaf(node))
+                {
+                    _leaf *existing = _as_leaf(node);
+                    art_key_bytes other = _bytes_of(existing);
+                    if (compare(other, key) == 0)
+                        return {existing, false};
+
+                    //두 key가 갈라지는 곳에 Node4를 둡니다.
+                    size_type common = depth;
+                    size_type limit = other.size() < key.size() ? other.size() : key.size();
+                    while (common < limit && other[common] == key[common])
+                        common++;
+
+                    after = make_leaf();
+                    _node *split;
+                    try
+                    {
+                        split = new _node4();
+                    }
+                    catch (...)
+                    {
+                        delete leaf;
+                        throw;
+                    }
+                    split->prefix_length = static_cast<std::uint32_t>(common - depth);
+                    std::memcpy(split->prefix, key.data() + depth, split->prefix_length < _max_prefix ? split->prefix_length : _max_prefix);
+                    this->_attach(&split, existing, other, common);
+                    this->_attach(&split, leaf, key, common);
+                    *slot = split;
+                    break;
+                }
+
+                size_type matched = _prefix_match(node, key, depth);
+                if (matched < node->prefix_length)
+                {
+                    //prefix 중간에서 갈라지면 위에 Node4를 두고 기존 node의 prefix를 줄입니다.
+                    unsigned char old_byte = _prefix_byte(node, matched, depth);
+                    after = make_leaf();
+                    _node *split;
+                    try
+                    {
+                        split = new _node4();
+                    }
+                    catch (...)
+                    {
+                        delete leaf;
+                        throw;
+                    }
+                    split->prefix_length = static_cast<std::uint32_t>(matched);
+                    std::memcpy(split->prefix, node->prefix, matched < _max_prefix ? matched : _max_prefix);
+                    node->prefix_length -= static_cast<std::uint32_t>(matched + 1);
+                    _load_prefix(node, depth + matched + 1);
+                    _add_child(&split, old_byte, node);
+                    this->_attach(&split, leaf, key, depth + matched);
+                    *slot = split;
+                    break;
+                }
+
+                depth += node->prefix_length;
+                if (depth == key.size())
+                {
+                    if (node->terminal != nullptr)
+                        return {node->terminal, false};
+                    after = make_leaf();
+                    node->terminal = leaf;
+                    break;
+                }
+
+                unsigned char byte = key[depth];
+                _node **child = _find_child(node, byte);
+                if (child == nullptr)
+                {
+                    after = make_leaf();
+                    try
+                    {
+                        _add_child(slot, byte, _tag(leaf));
+                    }
+                    catch (...)
+                    {
+                        delete leaf;
+                        throw;
+                    }
+                    break;
+                }
+                slot = child;
+                depth++;
+            }
+
+            this->_link_leaf(leaf, after);
+            this->_size++;
+            return {leaf, true};
+        }
+
+        //방금 만든 Node4(자리 있음)에 leaf를 terminal이나 자식으로 붙입니다.
+        static void _attach(_node **split, _leaf *leaf, const art_key_bytes &key, size_type depth)
+        {
+            if (key.size() == depth)
+                (*split)->terminal = leaf;
+            else
+                _add_child(split, key[depth], _tag(leaf));
+        }
+
+        //자식이나 terminal이 빠진 node를 정리합니다. depth는 node의 prefix가 시작하는 위치입니다.
+        static void _after_remove(_node **slot, size_type depth) noexcept
+        {
+            _node *node = *slot;
+            if (node->count == 0)
+            {
+                *slot = node->terminal != nullptr ? _tag(node->terminal) : nullptr;
+                _free_node(node);
+                return;
+            }
+            if (node->count == 1 && node->terminal == nullptr)
+            {
+                //하나 남은 자식과 합칩니다. 경로 = node prefix + byte + 자식 prefix
+                _node *child = _child_after(node, -1);
+                if (!_is_leaf(child))
+                {
+                    child->prefix_length += node->prefix_length + 1;
+                    _load_prefix(child, depth);
+                }
+                *slot = child;
+                _free_node(node);
+                return;
+            }
+
+            //작아진 node는 한 단계 작은 종류로 옮깁니다. 할당에 실패하면 그대로 둡니다.
+            try
+            {
+                if (node->kind == _kind16 && node->count <= 3)
+                {
+                    _node16 *n = static_cast<_node16 *>(node);
+                    _node4 *shrunk = new _node4();
+                    _copy_header(shrunk, n);
+                    std::memcpy(shrunk->keys, n->keys, n->count);
+                    std::memcpy(shrunk->children, n->children, n->count * sizeof(_node *));
+                    delete n;
+                    *slot = shrunk;
+                }
+                else if (node->kind == _kind48 && node->count <= 12)
+                {
+                    _node48 *n = static_cast<_node48 *>(node);
+                    _node16 *shrunk = new _node16();
+                    _copy_header(shrunk, n);
+                    unsigned position = 0;
+                    for (unsigned b = 0; b < 256; b++)
+                        if (n->index[b] != 0)
+                        {
+                            shrunk->keys[position] = static_cast<unsigned char>(b);
+                            shrunk->children[position++] = n->children[n->index[b] - 1];
+                        }
+                    delete n;
+                    *slot = shrunk;
+                }
+                else if (node->kind == _kind256 && node->count <= 37)
+                {
+                    _node256 *n = static_cast<_node256 *>(node);
+                    _node48 *shrunk = new _node48();
+                    _copy_header(shrunk, n);
+                    unsigned position = 0;
+                    for (unsigned b = 0; b < 256; b++)
+                        if (n->children[b] != nullptr)
+                        {
+                            shrunk->children[position] = n->children[b];
+                            shrunk->index[b] = static_cast<unsigned char>(++position);
+                        }
+                    delete n;
+                    *slot = shrunk;
+                }
+            }
+            catch (...)
+            {
+            }
+        }
+
+        //key의 leaf를 트리에서 떼어 돌려줍니다. (list에는 남아 있습니다)
+        static _leaf *_detach(_node **slot, const art_key_bytes &key, size_type depth) noexcept
+        {
+            _node *node = *slot;
+            if (node == nullptr)
+                return nullptr;
+            if (_is_leaf(node))
+            {
+                _leaf *leaf = _as_leaf(node);
+                if (compare(_bytes_of(leaf), key) != 0)
+                    return nullptr;
+                *slot = nullptr;
+                return leaf;
+            }
+
+            if (_prefix_match(node, key, depth) < node->prefix_length)
+                return nullptr;
+            size_type child_depth = depth + node->prefix_length;
+            if (child_depth == key.size())
+            {
+                _leaf *leaf = node->terminal;
+                if (leaf == nullptr)
+                    return nullptr;
+                node->terminal = nullptr;
+                _after_remove(slot, depth);
+                return leaf;
+            }
+
+            _node **child = _find_child(node, key[child_depth]);
+            if (child == nullptr)
+                return nullptr;
+            if (_is_leaf(*child))
+            {
+                _leaf *leaf = _as_leaf(*child);
+                if (compare(_bytes_of(leaf), key) != 0)
+                    return nullptr;
+                _remove_child(node, key[child_depth]);
+                _after_remove(slot, depth);
+                return leaf;
+            }
+            return _detach(child, key, child_depth + 1);
+        }
+
+        _leaf *_erase_leaf(_leaf *leaf) noexcept
+        {
+            _leaf *next = leaf->next;
+            _detach(&this->_root, _bytes_of(leaf), 0);
+            this->_unlink_leaf(leaf);
+            delete leaf;
+            this->_size--;
+            return next;
+        }
+
+    public:
+        art_map() = default;
+        art_map(std::initializer_list<value_type> init)
+        {
+            this->insert(init.begin(), init.end());
+        }
+        template <class InputIterator>
+        art_map(InputIterator first, InputIterator last)
+        {
+            this->insert(first, last);
+        }
+        ~art_map()
+        {
+            this->clear();
+        }
+
+    public: // copy&move member
+        art_map(const Self &other)
+        {
+            try
+            {
+                this->insert(other.begin(), other.end());
+            }
+            catch (...)
+            {
+                this->clear();
+                throw;
+            }
+        }
+        art_map(Self &&other) noexcept
+        {
+            this->swap(other);
+        }
+        Self &operator=(const Self &other)
+        {
+            if (this != &other)
+            {
+                Self copy(other);
+                this->swap(copy);
+            }
+            return *this;
+        }
+        Self &operator=(Self &&other) noexcept
+        {
+            if (this != &other)
+            {
+                this->clear();
+                this->swap(other);
+            }
+            return *this;
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_size == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_size;
+        }
+
+    public: //element access
+        mapped_type &operator[](const key_type &key)
+        {
+            return this->_try_emplace(key).first->value.second;
+        }
+        mapped_type &operator[](key_type &&key)
+        {
+            return this->_try_emplace(std::move(key)).first->value.second;
+        }
+        mapped_type &at(const key_type &key)
+        {
+            _leaf *leaf = this->_find_leaf(KeyTraits::encode(key));
+            if (leaf == nullptr)
+                throw std::out_of_range("art_map::at");
+            return leaf->value.second;
+        }
+        const mapped_type &at(const key_type &key) const
+        {
+            _leaf *leaf = this->_find_leaf(KeyTraits::encode(key));
+            if (leaf == nullptr)
+                throw std::out_of_range("art_map::at");
+            return leaf->value.second;
+        }
+
+    public: //modifiers
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type &key, Args &&... args)
+        {
+            auto result = this->_try_emplace(key, std::forward<Args>(args)...);
+            return {iterator(result.first, this), result.second};
+        }
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(key_type &&key, Args &&... args)
+        {
+            auto result = this->_try_emplace(std::move(key), std::forward<Args>(args)...);
+            return {iterator(result.first, this), result.second};
+        }
+        template <class K, class M>
+        std::pair<iterator, bool> emplace(K &&key, M &&mapped)
+        {
+            return this->try_emplace(std::forward<K>(key), std::forward<M>(mapped));
+        }
+        std::pair<iterator, bool> insert(const value_type &value)
+        {
+            return this->try_emplace(value.first, value.second);
+        }
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+                this->insert(*first);
+        }
+        void insert(std::initializer_list<value_type> init)
+        {
+            this->insert(init.begin(), init.end());
+        }
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&mapped)
+        {
+            auto result = this->try_emplace(key, std::forward<M>(mapped));
+            if (!result.second)
+                result.first->second = std::forward<M>(mapped);
+            return result;
+        }
+
+        size_type erase(const key_type &key)
+        {
+            _leaf *leaf = _detach(&this->_root, KeyTraits::encode(key), 0);
+            if (leaf == nullptr)
+                return 0;
+            this->_unlink_leaf(leaf);
+            delete leaf;
+            this->_size--;
+            return 1;
+        }
+        iterator erase(const_iterator pos)
+        {
+            assert(pos.current != nullptr);
+            return iterator(this->_erase_leaf(const_cast<_leaf *>(pos.current)), this);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+                first = this->erase(first);
+            return iterator(const_cast<_leaf *>(last.current), this);
+        }
+
+        void clear() noexcept
+        {
+            _free_tree(this->_root);
+            for (_leaf *leaf = this->_head; leaf != nullptr;)
+            {
+                _leaf *next = leaf->next;
+                delete leaf;
+                leaf = next;
+            }
+            this->_root = nullptr;
+            this->_head = this->_tail = nullptr;
+            this->_size = 0;
+        }
+
+        void swap(Self &other) noexcept
+        {
+            std::swap(this->_root, other._root);
+            std::swap(this->_head, other._head);
+            std::swap(this->_tail, other._tail);
+            std::swap(this->_size, other._size);
+        }
+
+    public: //lookup
+        iterator find(const key_type &key)
+        {
+            return iterator(this->_find_leaf(KeyTraits::encode(key)), this);
+        }
+        const_iterator find(const key_type &key) const
+        {
+            return const_iterator(this->_find_leaf(KeyTraits::encode(key)), this);
+        }
+        bool contains(const key_type &key) const
+        {
+            return this->_find_leaf(KeyTraits::encode(key)) != nullptr;
+        }
+        size_type count(const key_type &key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        //key보다 작지 않은 첫 요소입니다.
+        iterator lower_bound(const key_type &key)
+        {
+            return iterator(this->_lower_bound_leaf(KeyTraits::encode(key)), this);
+        }
+        const_iterator lower_bound(const key_type &key) const
+        {
+            return const_iterator(this->_lower_bound_leaf(KeyTraits::encode(key)), this);
+        }
+        //key보다 큰 첫 요소입니다.
+        iterator upper_bound(const key_type &key)
+        {
+            art_key_bytes bytes = KeyTraits::encode(key);
+            _leaf *leaf = this->_lower_bound_leaf(bytes);
+            return iterator(leaf != nullptr && compare(_bytes_of(leaf), bytes) == 0 ? leaf->next : leaf, this);
+        }
+        const_iterator upper_bound(const key_type &key) const
+        {
+            return const_cast<Self *>(this)->upper_bound(key);
+        }
+
+        //byte 열이 prefix로 시작하는 모든 요소입니다. (문자열 key의 경로 scan)
+        range_type prefix_range(const key_type &prefix)
+        {
+            auto bounds = this->_prefix_bounds(KeyTraits::encode(prefix));
+            return range_type(iterator(bounds.first, this), iterator(bounds.second, this));
+        }
+        const_range_type prefix_range(const key_type &prefix) const
+        {
+            auto bounds = this->_prefix_bounds(KeyTraits::encode(prefix));
+            return const_range_type(const_iterator(bounds.first, this), const_iterator(bounds.second, this));
+        }
+        //key를 byte로 바꾼 앞 prefix_bytes byte가 같은 요소들입니다. (정수 key의 상위 byte scan)
+        range_type prefix_range(const key_type &key, size_type prefix_bytes)
+        {
+            art_key_bytes bytes = KeyTraits::encode(key);
+            bytes.truncate(prefix_bytes);
+            auto bounds = this->_prefix_bounds(bytes);
+            return range_type(iterator(bounds.first, this), iterator(bounds.second, this));
+        }
+        const_range_type prefix_range(const key_type &key, size_type prefix_bytes) const
+        {
+            art_key_bytes bytes = KeyTraits::encode(key);
+            bytes.truncate(prefix_bytes);
+            auto bounds = this->_prefix_bounds(bytes);
+            return const_range_type(const_iterator(bounds.first, this), const_iterator(bounds.second, this));
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            return iterator(this->_head, this);
+        }
+        iterator end() noexcept
+        {
+            return iterator(nullptr, this);
+        }
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(this->_head, this);
+        }
+        const_iterator end() const noexcept
+        {
+            return const_iterator(nullptr, this);
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return this->begin();
+        }
+        const_iterator cend() const noexcept
+        {
+            return this->end();
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(this->end());
+        }
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(this->begin());
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return this->rbegin();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return this->rend();
+        }
+
+    public:
+        class iterator
+        {
+        private:
+            friend art_map;
+            _leaf *current = nullptr;
+            const art_map *owner = nullptr; //end()에서 --할 때 tail을 찾기 위함입니다.
+
+        public:
+            using Self = iterator;
+
+        public:
+            using value_type = typename art_map::value_type;
+            using pointer = typename art_map::pointer;
+            using reference = typename art_map::reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            iterator() = default;
+            iterator(_leaf *p, const art_map *map) : current(p), owner(map)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(current != nullptr);
+                current = current->next;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self old = *this;
+                ++*this;
+                return old;
+            }
+            Self &operator--()
+            {
+                current = current == nullptr ? owner->_tail : current->prev;
+                assert(current != nullptr);
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self old = *this;
+                --*this;
+                return old;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                assert(current != nullptr);
+                return current->value;
+            }
+            pointer operator->() const
+            {
+                assert(current != nullptr);
+                return &current->value;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+
+        class const_iterator
+        {
+        private:
+            friend art_map;
+            const _leaf *current = nullptr;
+            const art_map *owner = nullptr;
+
+        public:
+            using Self = const_iterator;
+
+        public:
+            using value_type = typename art_map::value_type;
+            using pointer = typename art_map::const_pointer;
+            using reference = typename art_map::const_reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            const_iterator() = default;
+            const_iterator(const _leaf *p, const art_map *map) : current(p), owner(map)
+            {
+            }
+            const_iterator(const iterator &mutable_iterator) : current(mutable_iterator.current), owner(mutable_iterator.owner)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(current != nullptr);
+                current = current->next;
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self old = *this;
+                ++*this;
+                return old;
+            }
+            Self &operator--()
+            {
+                current = current == nullptr ? owner->_tail : current->prev;
+                assert(current != nullptr);
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self old = *this;
+                --*this;
+                return old;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                assert(current != nullptr);
+                return current->value;
+            }
+            pointer operator->() const
+            {
+                assert(current != nullptr);
+                return &current->value;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+
+        //range-for에 바로 쓸 수 있는 [begin, end) 쌍입니다.
+        template <class Iterator>
+        class basic_range
+        {
+        private:
+            Iterator _first;
+            Iterator _last;
+
+        public:
+            basic_range(Iterator first, Iterator last) : _first(first), _last(last)
+            {
+            }
+            Iterator begin() const
+            {
+                return this->_first;
+            }
+            Iterator end() const
+            {
+                return this->_last;
+            }
+            bool empty() const
+            {
+                return this->_first == this->_last;
+            }
+        };
+    };
+
+    template <class Key, class V, class KeyTraits>
+    constexpr std::size_t art_map<Key, V, KeyTraits>::_max_prefix;
+} // namespace xstl
+
+#endif
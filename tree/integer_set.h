@@ -0,0 +1,529 @@
+#ifndef __XSTL_INTEGER_SET__
+#define __XSTL_INTEGER_SET__
+
+/*
+    Ordered Set of Unsigned Integers (64-ary hashed trie, x-fast style).
+    A key is split into 6 bit digits. Level 0 holds 64 bit bitmaps of keys ("leaves") chained in key order;
+    level h > 0 holds bitmaps of non-empty children plus the min/max key below them.
+    Every level lives in its own flat_hash_map keyed by prefix, so memory follows the number of keys, not the universe.
+    successor/predecessor binary search the levels for the deepest existing ancestor (O(log log U) probes)
+    and then finish with one tzcnt/lzcnt and the leaf chain.
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include "../hash/flat_hash_map.h"
+#include "../utility/bit_operation.h"
+
+namespace xstl
+{
+    template <class Key = std::uint64_t>
+    class integer_set
+    {
+        static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value, "Key must be an unsigned integer");
+
+    public:
+        using Self = integer_set;
+
+    public: //stl standard type member
+        using key_type = Key;
+        using value_type = Key;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        class const_iterator;
+        using iterator = const_iterator;
+
+    public:
+        static constexpr unsigned key_bits = sizeof(Key) * 8;
+        static constexpr unsigned level_count = (key_bits + 5) / 6;
+
+    private:
+        //leaf prefix는 key >> 6이므로 모든 bit가 1인 값은 나올 수 없습니다.
+        static constexpr Key _none = static_cast<Key>(~static_cast<Key>(0));
+
+        struct _leaf
+        {
+            std::uint64_t bits = 0;
+            Key prev = _none; //key 순서로 앞/뒤 leaf의 prefix
+            Key next = _none;
+        };
+        struct _node
+        {
+            std::uint64_t bits = 0; //비어 있지 않은 자식
+            Key min = 0;            //이 node 아래의 가장 작은/큰 key
+            Key max = 0;
+        };
+
+        flat_hash_map<Key, _leaf> _leaves;
+        flat_hash_map<Key, _node> _nodes[level_count - 1]; //_nodes[h - 1]이 level h입니다.
+        Key _first_leaf = _none;
+        Key _last_leaf = _none;
+        size_type _size = 0;
+
+    private:
+        static Key _prefix(Key key, unsigned level) noexcept
+        {
+            unsigned shift = 6 * level + 6;
+            return shift >= key_bits ? 0 : static_cast<Key>(key >> shift);
+        }
+        static unsigned _digit(Key key, unsigned level) noexcept
+        {
+            return static_cast<unsigned>(key >> (6 * level)) & 63;
+        }
+        static std::uint64_t _above(std::uint64_t bits, unsigned digit) noexcept
+        {
+            return digit == 63 ? 0 : bits & (~0ull << (digit + 1));
+        }
+        static std::uint64_t _below(std::uint64_t bits, unsigned digit) noexcept
+        {
+            return bits & ((1ull << digit) - 1);
+        }
+
+        _node *_node_at(unsigned level, Key prefix) const
+        {
+            auto &nodes = const_cast<flat_hash_map<Key, _node> &>(this->_nodes[level - 1]);
+            auto found = nodes.find(prefix);
+            return found == nodes.end() ? nullptr : &found->second;
+        }
+        const _leaf &_leaf_at(Key prefix) const
+        {
+            return this->_leaves.find(prefix)->second;
+        }
+        Key _leaf_min(Key prefix) const
+        {
+            return static_cast<Key>((prefix << 6) | _count_trailing_zero64(this->_leaf_at(prefix).bits));
+        }
+        Key _leaf_max(Key prefix) const
+        {
+            return static_cast<Key>((prefix << 6) | (63 - _count_leading_zero64(this->_leaf_at(prefix).bits)));
+        }
+
+        //level의 prefix node에서 digit번째 자식 아래의 최솟값/최댓값입니다.
+        Key _child_min(unsigned level, Key prefix, unsigned digit) const
+        {
+            Key child = static_cast<Key>((prefix << 6) | digit);
+            return level == 1 ? this->_leaf_min(child) : this->_node_at(level - 1, child)->min;
+        }
+        Key _child_max(unsigned level, Key prefix, unsigned digit) const
+        {
+            Key child = static_cast<Key>((prefix << 6) | digit);
+            return level == 1 ? this->_leaf_max(child) : this->_node_at(level - 1, child)->max;
+        }
+
+        //key를 담은 node가 있는 가장 낮은 level입니다. (level 0 leaf는 없다고 알고 있을 때)
+        //ancestor는 항상 있으므로 존재 여부가 level에 대해 단조이고, 이진 탐색할 수 있습니다.
+        unsigned _deepest_ancestor(Key key) const
+        {
+            unsigned absent = 0, present = level_count - 1;
+            while (present - absent > 1)
+            {
+                unsigned middle = (absent + present) / 2;
+                if (this->_node_at(middle, _prefix(key, middle)) != nullptr)
+                    present = middle;
+                else
+                    absent = middle;
+            }
+            return present;
+        }
+
+        //level부터 위로, key가 범위를 넓히지 않는 node를 만나면 멈춥니다.
+        void _grow_bounds(unsigned level, Key key)
+        {
+            for (; level < level_count; level++)
+            {
+                _node *node = this->_node_at(level, _prefix(key, level));
+                bool changed = false;
+                if (key < node->min)
+                    node->min = key, changed = true;
+                if (key > node->max)
+                    node->max = key, changed = true;
+                if (!changed)
+                    return;
+            }
+        }
+        //지워진 key가 min/max였던 node만 자식에서 다시 구합니다. 아래 level부터 갱신되어 있어야 합니다.
+        void _shrink_bounds(unsigned level, Key key)
+        {
+            for (; level < level_count; level++)
+            {
+                Key prefix = _prefix(key, level);
+                _node *node = this->_node_at(level, prefix);
+                bool changed = false;
+                if (node->min == key)
+                    node->min = this->_child_min(level, prefix, _count_trailing_zero64(node->bits)), changed = true;
+                if (node->max == key)
+                    node->max = this->_child_max(level, prefix, 63 - _count_leading_zero64(node->bits)), changed = true;
+                if (!changed)
+                    return;
+            }
+        }
+
+    public:
+        integer_set() = default;
+        integer_set(std::initializer_list<key_type> init)
+        {
+            for (Key key : init)
+                this->insert(key);
+        }
+        template <class InputIterator>
+        integer_set(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+                this->insert(*first);
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_size == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_size;
+        }
+
+    public: //lookup
+        bool contains(key_type key) const
+        {
+            auto found = this->_leaves.find(static_cast<Key>(key >> 6));
+            return found != this->_leaves.end() && (found->second.bits >> (key & 63) & 1) != 0;
+        }
+        size_type count(key_type key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        //key보다 큰 가장 작은 값을 out에 넣습니다. 없으면 false입니다.
+        bool successor(key_type key, key_type &out) const
+        {
+            Key leaf_prefix = static_cast<Key>(key >> 6);
+            auto leaf = this->_leaves.find(leaf_prefix);
+            if (leaf != this->_leaves.end())
+            {
+                std::uint64_t above = _above(leaf->second.bits, _digit(key, 0));
+                if (above != 0)
+                {
+                    out = static_cast<Key>((leaf_prefix << 6) | _count_trailing_zero64(above));
+                    return true;
+                }
+                if (leaf->second.next == _none)
+                    return false;
+                out = this->_leaf_min(leaf->second.next);
+                return true;
+            }
+            if (this->_size == 0)
+                return false;
+
+            //가장 깊은 ancestor에서 key의 자식은 비어 있으므로, 답은 오른쪽 형제의 최솟값이거나 왼쪽 형제 최댓값의 다음입니다.
+            unsigned level = this->_deepest_ancestor(key);
+            Key prefix = _prefix(key, level);
+            const _node &node = *this->_node_at(level, prefix);
+            std::uint64_t above = _above(node.bits, _digit(key, level));
+            if (above != 0)
+            {
+                out = this->_child_min(level, prefix, _count_trailing_zero64(above));
+                return true;
+            }
+            Key before = this->_child_max(level, prefix, 63 - _count_leading_zero64(_below(node.bits, _digit(key, level))));
+            Key next = this->_leaf_at(static_cast<Key>(before >> 6)).next;
+            if (next == _none)
+                return false;
+            out = this->_leaf_min(next);
+            return true;
+        }
+
+        //key보다 작은 가장 큰 값을 out에 넣습니다. 없으면 false입니다.
+        bool predecessor(key_type key, key_type &out) const
+        {
+            Key leaf_prefix = static_cast<Key>(key >> 6);
+            auto leaf = this->_leaves.find(leaf_prefix);
+            if (leaf != this->_leaves.end())
+            {
+                std::uint64_t below = _below(leaf->second.bits, _digit(key, 0));
+                if (below != 0)
+                {
+                    out = static_cast<Key>((leaf_prefix << 6) | (63 - _count_leading_zero64(below)));
+                    return true;
+                }
+                if (leaf->second.prev == _none)
+                    return false;
+                out = this->_leaf_max(leaf->second.prev);
+                return true;
+            }
+            if (this->_size == 0)
+                return false;
+
+            unsigned level = this->_deepest_ancestor(key);
+            Key prefix = _prefix(key, level);
+            const _node &node = *this->_node_at(level, prefix);
+            std::uint64_t below = _below(node.bits, _digit(key, level));
+            if (below != 0)
+            {
+                out = this->_child_max(level, prefix, 63 - _count_leading_zero64(below));
+                return true;
+            }
+            Key after = this->_child_min(level, prefix, _count_trailing_zero64(_above(node.bits, _digit(key, level))));
+            Key prev = this->_leaf_at(static_cast<Key>(after >> 6)).prev;
+            if (prev == _none)
+                return false;
+            out = this->_leaf_max(prev);
+            return true;
+        }
+
+        key_type min() const
+        {
+            assert(this->_size != 0);
+            return this->_leaf_min(this->_first_leaf);
+        }
+        key_type max() const
+        {
+            assert(this->_size != 0);
+            return this->_leaf_max(this->_last_leaf);
+        }
+
+        const_iterator find(key_type key) const
+        {
+            return this->contains(key) ? const_iterator(this, key) : this->end();
+        }
+        //key보다 작지 않은 첫 값입니다.
+        const_iterator lower_bound(key_type key) const
+        {
+            Key found;
+            if (this->contains(key))
+                return const_iterator(this, key);
+            return this->successor(key, found) ? const_iterator(this, found) : this->end();
+        }
+        //key보다 큰 첫 값입니다.
+        const_iterator upper_bound(key_type key) const
+        {
+            Key found;
+            return this->successor(key, found) ? const_iterator(this, found) : this->end();
+        }
+
+    public: //modifiers
+        bool insert(key_type key)
+        {
+            Key leaf_prefix = static_cast<Key>(key >> 6);
+            std::uint64_t bit = 1ull << _digit(key, 0);
+            auto found = this->_leaves.find(leaf_prefix);
+            if (found != this->_leaves.end())
+            {
+                if ((found->second.bits & bit) != 0)
+                    return false;
+                found->second.bits |= bit;
+                this->_size++;
+                this->_grow_bounds(1, key);
+                return true;
+            }
+
+            //새 leaf를 key 순서의 chain에 끼웁니다.
+            _leaf leaf;
+            leaf.bits = bit;
+            Key before;
+            if (this->predecessor(key, before))
+            {
+                leaf.prev = static_cast<Key>(before >> 6);
+                leaf.next = this->_leaf_at(leaf.prev).next;
+            }
+            else
+                leaf.next = this->_first_leaf;
+            this->_leaves.emplace(leaf_prefix, leaf);
+            (leaf.prev == _none ? this->_first_leaf : this->_leaves.find(leaf.prev)->second.next) = leaf_prefix;
+            (leaf.next == _none ? this->_last_leaf : this->_leaves.find(leaf.next)->second.prev) = leaf_prefix;
+
+            //없는 ancestor를 만들며 올라가다 이미 있는 node를 만나면, 그 위로는 min/max만 고칩니다.
+            for (unsigned level = 1; level < level_count; level++)
+            {
+                auto result = this->_nodes[level - 1].try_emplace(_prefix(key, level));
+                _node &node = result.first->second;
+                node.bits |= 1ull << _digit(key, level);
+                if (result.second)
+                {
+                    node.min = node.max = key;
+                    continue;
+                }
+                this->_grow_bounds(level, key);
+                break;
+            }
+            this->_size++;
+            return true;
+        }
+
+        bool erase(key_type key)
+        {
+            Key leaf_prefix = static_cast<Key>(key >> 6);
+            std::uint64_t bit = 1ull << _digit(key, 0);
+            auto found = this->_leaves.find(leaf_prefix);
+            if (found == this->_leaves.end() || (found->second.bits & bit) == 0)
+                return false;
+
+            this->_size--;
+            found->second.bits &= ~bit;
+            if (found->second.bits != 0)
+            {
+                this->_shrink_bounds(1, key);
+                return true;
+            }
+
+            //빈 leaf는 chain에서 빼고, 비게 된 ancestor도 함께 지웁니다.
+            _leaf leaf = found->second;
+            this->_leaves.erase(found);
+            (leaf.prev == _none ? this->_first_leaf : this->_leaves.find(leaf.prev)->second.next) = leaf.next;
+            (leaf.next == _none ? this->_last_leaf : this->_leaves.find(leaf.next)->second.prev) = leaf.prev;
+
+            for (unsigned level = 1; level < level_count; level++)
+            {
+                Key prefix = _prefix(key, level);
+                _node *node = this->_node_at(level, prefix);
+                node->bits &= ~(1ull << _digit(key, level));
+                if (node->bits == 0)
+                {
+                    this->_nodes[level - 1].erase(prefix);
+                    continue;
+                }
+                this->_shrink_bounds(level, key);
+                break;
+            }
+            return true;
+        }
+
+        void clear() noexcept
+        {
+            this->_leaves.clear();
+            for (auto &nodes : this->_nodes)
+                nodes.clear();
+            this->_first_leaf = this->_last_leaf = _none;
+            this->_size = 0;
+        }
+
+        void swap(Self &other) noexcept
+        {
+            using std::swap;
+            this->_leaves.swap(other._leaves);
+            for (unsigned level = 0; level + 1 < level_count; level++)
+                this->_nodes[level].swap(other._nodes[level]);
+            swap(this->_first_leaf, other._first_leaf);
+            swap(this->_last_leaf, other._last_leaf);
+            swap(this->_size, other._size);
+        }
+
+    public: //iterator
+        const_iterator begin() const
+        {
+            return this->_size == 0 ? this->end() : const_iterator(this, this->min());
+        }
+        const_iterator end() const
+        {
+            return const_iterator(this);
+        }
+        const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+        const_iterator cend() const
+        {
+            return this->end();
+        }
+
+    public:
+        //오름차순 전진 iterator입니다. leaf 안에서는 bit 연산만, leaf를 넘어갈 때 hash 검색 한 번을 씁니다.
+        //set이 바뀌면 무효가 됩니다.
+        class const_iterator
+        {
+        private:
+            friend integer_set;
+            const integer_set *owner = nullptr;
+            Key current = 0;
+            std::uint64_t rest = 0; //현재 leaf에서 current보다 큰 값들
+            Key next_leaf = _none;
+            bool at_end = true;
+
+        public:
+            using Self = const_iterator;
+
+        public:
+            using value_type = Key;
+            using pointer = const Key *;
+            using reference = const Key &;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+        private:
+            explicit const_iterator(const integer_set *set) : owner(set)
+            {
+            }
+            const_iterator(const integer_set *set, Key key) : owner(set), current(key), at_end(false)
+            {
+                const _leaf &leaf = set->_leaf_at(static_cast<Key>(key >> 6));
+                this->rest = _above(leaf.bits, _digit(key, 0));
+                this->next_leaf = leaf.next;
+            }
+
+        public:
+            const_iterator() = default;
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(!at_end);
+                if (rest != 0)
+                {
+                    unsigned digit = _count_trailing_zero64(rest);
+                    rest &= rest - 1;
+                    current = static_cast<Key>((current & ~static_cast<Key>(63)) | digit);
+                }
+                else if (next_leaf == _none)
+                    at_end = true;
+                else
+                {
+                    const _leaf &leaf = owner->_leaf_at(next_leaf);
+                    current = static_cast<Key>((next_leaf << 6) | _count_trailing_zero64(leaf.bits));
+                    rest = leaf.bits & (leaf.bits - 1);
+                    next_leaf = leaf.next;
+                }
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self old = *this;
+                ++*this;
+                return old;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                assert(!at_end);
+                return current;
+            }
+            pointer operator->() const
+            {
+                assert(!at_end);
+                return &current;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->at_end == other.at_end && (this->at_end || this->current == other.current);
+            }
+            bool operator!=(const Self &other) const
+            {
+                return !(*this == other);
+            }
+        };
+    };
+
+    template <class Key>
+    constexpr unsigned integer_set<Key>::key_bits;
+    template <class Key>
+    constexpr unsigned integer_set<Key>::level_count;
+    template <class Key>
+    constexpr Key integer_set<Key>::_none;
+} // namespace xstl
+
+#endif
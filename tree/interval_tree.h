@@ -0,0 +1,750 @@
+#ifndef __XSTL_INTERVAL_TREE__
+#define __XSTL_INTERVAL_TREE__
+
+/*
+    Augmented Interval Tree.
+    Closed intervals [low, high] are ordered by (low, high); equal intervals may repeat.
+    Every node also keeps the largest high endpoint of its subtree (max), recomputed in _rotate
+    the same way splay_tree::_rotate moves a node into its parent's place.
+    Shape comes from random treap priorities, so depth stays O(log n) expected without restructuring on reads,
+    and a query can be walked lazily: overlapping() and stabbing() return a range whose iterator
+    finds the next match only when advanced, pruning subtrees whose max is below the query.
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace xstl
+{
+    //양 끝을 포함하는 구간입니다.
+    template <class T>
+    struct interval
+    {
+        T low;
+        T high;
+    };
+
+    template <class T, class V, class Compare = std::less<T>>
+    class interval_tree
+    {
+    public:
+        using Self = interval_tree;
+
+    public: //stl standard type member
+        using interval_type = interval<T>;
+        using endpoint_type = T;
+        using mapped_type = V;
+        using value_type = std::pair<const interval_type, V>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using endpoint_compare = Compare;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using pointer = value_type *;
+        using const_pointer = const value_type *;
+        class iterator;
+        class const_iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        class query_iterator;
+        class query_range;
+
+    public:
+        static constexpr std::uint64_t default_seed = 0x9e3779b97f4a7c15ull;
+
+    private:
+        struct _node
+        {
+            _node *parent = nullptr;
+            _node *left = nullptr;
+            _node *right = nullptr;
+            std::uint64_t priority; //부모보다 작거나 같습니다. (max-heap)
+            T max;                  //subtree 안 high의 최댓값
+            value_type value;
+
+            template <class... Args>
+            _node(std::uint64_t _priority, const interval_type &range, Args &&... args)
+                : priority(_priority), max(range.high), value(std::piecewise_construct, std::forward_as_tuple(range), std::forward_as_tuple(std::forward<Args>(args)...))
+            {
+            }
+        };
+
+        _node *_root = nullptr;
+        size_type _length = 0;
+        std::uint64_t _random = default_seed;
+        Compare _compare;
+
+    private: //compare helper
+        bool _less(const T &left, const T &right) const
+        {
+            return this->_compare(left, right);
+        }
+        //(low, high) 사전순입니다.
+        bool _before(const interval_type &left, const interval_type &right) const
+        {
+            return this->_less(left.low, right.low) || (!this->_less(right.low, left.low) && this->_less(left.high, right.high));
+        }
+
+    private: //node helper
+        std::uint64_t _next_priority() noexcept
+        {
+            std::uint64_t x = this->_random;
+            x ^= x >> 12;
+            x ^= x << 25;
+            x ^= x >> 27;
+            this->_random = x;
+            return x * 0x2545f4914f6cdd1dull;
+        }
+
+        //자식들의 max로 node의 max를 다시 계산합니다.
+        void _update(_node *node)
+        {
+            node->max = node->value.first.high;
+            if (node->left != nullptr && this->_less(node->max, node->left->max))
+                node->max = node->left->max;
+            if (node->right != nullptr && this->_less(node->max, node->right->max))
+                node->max = node->right->max;
+        }
+
+        //전달되는 노드를 해당 노드의 부모 위치로 옮깁니다. 아래로 내려간 부모부터 max를 고칩니다.
+        void _rotate(_node *node)
+        {
+            _node *parent = node->parent;
+            _node *moved = nullptr;
+
+            if (node == parent->left)
+            {
+                parent->left = moved = node->right;
+                node->right = parent;
+            }
+            else
+            {
+                parent->right = moved = node->left;
+                node->left = parent;
+            }
+
+            node->parent = parent->parent;
+            parent->parent = node;
+
+            if (moved != nullptr)
+                moved->parent = parent;
+
+            (node->parent != nullptr ? (parent == node->parent->left ? node->parent->left : node->parent->right) : this->_root) = node;
+
+            this->_update(parent);
+            this->_update(node);
+        }
+
+        static _node *_leftmost(_node *node) noexcept
+        {
+            if (node != nullptr)
+                while (node->left != nullptr)
+                    node = node->left;
+            return node;
+        }
+        static _node *_rightmost(_node *node) noexcept
+        {
+            if (node != nullptr)
+                while (node->right != nullptr)
+                    node = node->right;
+            return node;
+        }
+        static _node *_successor(_node *node) noexcept
+        {
+            if (node->right != nullptr)
+                return _leftmost(node->right);
+            while (node->parent != nullptr && node == node->parent->right)
+                node = node->parent;
+            return node->parent;
+        }
+        static _node *_predecessor(_node *node) noexcept
+        {
+            if (node->left != nullptr)
+                return _rightmost(node->left);
+            while (node->parent != nullptr && node == node->parent->left)
+                node = node->parent;
+            return node->parent;
+        }
+
+        static void _destroy(_node *node) noexcept
+        {
+            if (node == nullptr)
+                return;
+            _destroy(node->left);
+            _destroy(node->right);
+            delete node;
+        }
+        //priority까지 그대로 복사하므로 모양이 같습니다.
+        static _node *_copy(const _node *node, _node *parent)
+        {
+            if (node == nullptr)
+                return nullptr;
+            _node *copied = new _node(node->priority, node->value.first, node->value.second);
+            copied->parent = parent;
+            copied->max = node->max;
+            try
+            {
+                copied->left = _copy(node->left, copied);
+                copied->right = _copy(node->right, copied);
+            }
+            catch (...)
+            {
+                _destroy(copied);
+                throw;
+            }
+            return copied;
+        }
+
+    private: //query
+        //subtree에서 [low, high]와 겹치는 중위 순서 첫 node입니다.
+        _node *_first_match(_node *node, const T &low, const T &high) const
+        {
+            while (node != nullptr)
+            {
+                if (this->_less(node->max, low))
+                    return nullptr;
+                //왼쪽 max가 low 이상이면 겹치는 것이 왼쪽에 있거나, 그 구간의 low가 high보다 커서 이 subtree 어디에도 없습니다.
+                if (node->left != nullptr && !this->_less(node->left->max, low))
+                {
+                    node = node->left;
+                    continue;
+                }
+                if (this->_less(high, node->value.first.low))
+                    return nullptr;
+                if (!this->_less(node->value.first.high, low))
+                    return node;
+                node = node->right;
+            }
+            return nullptr;
+        }
+        //중위 순서로 node 다음에 오는 겹치는 node입니다.
+        _node *_next_match(_node *node, const T &low, const T &high) const
+        {
+            if (_node *found = this->_first_match(node->right, low, high))
+                return found;
+            for (; node->parent != nullptr; node = node->parent)
+            {
+                _node *parent = node->parent;
+                if (node != parent->left)
+                    continue;
+                //이후 node는 모두 low가 parent 이상입니다.
+                if (this->_less(high, parent->value.first.low))
+                    return nullptr;
+                if (!this->_less(parent->value.first.high, low))
+                    return parent;
+                if (_node *found = this->_first_match(parent->right, low, high))
+                    return found;
+            }
+            return nullptr;
+        }
+
+    public:
+        interval_tree() = default;
+        explicit interval_tree(const Compare &compare, std::uint64_t seed = default_seed) : _random(seed == 0 ? default_seed : seed), _compare(compare)
+        {
+        }
+        interval_tree(std::initializer_list<value_type> init)
+        {
+            for (const auto &value : init)
+                this->insert(value);
+        }
+        ~interval_tree()
+        {
+            this->clear();
+        }
+
+    public: //copy & move
+        interval_tree(const Self &other) : _root(_copy(other._root, nullptr)), _length(other._length), _random(other._random), _compare(other._compare)
+        {
+        }
+        interval_tree(Self &&other) noexcept : _compare(other._compare)
+        {
+            this->swap(other);
+        }
+        Self &operator=(const Self &other)
+        {
+            if (this != &other)
+            {
+                Self copy(other);
+                this->swap(copy);
+            }
+            return *this;
+        }
+        Self &operator=(Self &&other) noexcept
+        {
+            if (this != &other)
+            {
+                this->clear();
+                this->swap(other);
+            }
+            return *this;
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+
+    public: //modifiers
+        //같은 구간이 이미 있어도 뒤에 하나 더 넣습니다.
+        template <class... Args>
+        iterator emplace(const interval_type &range, Args &&... args)
+        {
+            assert(!this->_less(range.high, range.low));
+            _node *node = new _node(this->_next_priority(), range, std::forward<Args>(args)...);
+
+            //내려가는 길의 max는 미리 늘려 둡니다.
+            _node *parent = nullptr;
+            _node **slot = &this->_root;
+            while (*slot != nullptr)
+            {
+                parent = *slot;
+                if (this->_less(parent->max, range.high))
+                    parent->max = range.high;
+                slot = this->_before(range, parent->value.first) ? &parent->left : &parent->right;
+            }
+            *slot = node;
+            node->parent = parent;
+
+            while (node->parent != nullptr && node->parent->priority < node->priority)
+                this->_rotate(node);
+
+            this->_length++;
+            return iterator(node, this);
+        }
+        iterator insert(const interval_type &range, const mapped_type &value)
+        {
+            return this->emplace(range, value);
+        }
+        iterator insert(const interval_type &range, mapped_type &&value)
+        {
+            return this->emplace(range, std::move(value));
+        }
+        iterator insert(const value_type &value)
+        {
+            return this->emplace(value.first, value.second);
+        }
+
+        //node를 잎까지 회전으로 내린 뒤 떼어 냅니다.
+        iterator erase(const_iterator position)
+        {
+            _node *node = const_cast<_node *>(position.current);
+            assert(node != nullptr);
+            _node *next = _successor(node);
+
+            while (node->left != nullptr || node->right != nullptr)
+            {
+                _node *child = node->left == nullptr ? node->right
+                             : node->right == nullptr ? node->left
+                             : (node->left->priority > node->right->priority ? node->left : node->right);
+                this->_rotate(child);
+            }
+
+            _node *parent = node->parent;
+            (parent != nullptr ? (node == parent->left ? parent->left : parent->right) : this->_root) = nullptr;
+            for (; parent != nullptr; parent = parent->parent)
+                this->_update(parent);
+
+            delete node;
+            this->_length--;
+            return iterator(next, this);
+        }
+        //range와 같은 구간 하나를 지웁니다.
+        size_type erase(const interval_type &range)
+        {
+            iterator found = this->find(range);
+            if (found == this->end())
+                return 0;
+            this->erase(found);
+            return 1;
+        }
+
+        void clear() noexcept
+        {
+            _destroy(this->_root);
+            this->_root = nullptr;
+            this->_length = 0;
+        }
+
+        void swap(Self &other) noexcept
+        {
+            using std::swap;
+            swap(this->_root, other._root);
+            swap(this->_length, other._length);
+            swap(this->_random, other._random);
+            swap(this->_compare, other._compare);
+        }
+
+        //이후 삽입되는 node의 priority를 정하는 난수 상태를 다시 정합니다.
+        void seed(std::uint64_t value) noexcept
+        {
+            this->_random = value == 0 ? default_seed : value;
+        }
+
+    public: //lookup
+        //range와 같은 구간 중 중위 순서로 첫 번째입니다.
+        iterator find(const interval_type &range)
+        {
+            _node *node = this->_root;
+            _node *found = nullptr;
+            while (node != nullptr)
+            {
+                if (this->_before(node->value.first, range))
+                    node = node->right;
+                else
+                {
+                    if (!this->_before(range, node->value.first))
+                        found = node;
+                    node = node->left;
+                }
+            }
+            return iterator(found, this);
+        }
+        const_iterator find(const interval_type &range) const
+        {
+            return const_cast<Self *>(this)->find(range);
+        }
+        bool contains(const interval_type &range) const
+        {
+            return this->find(range) != this->end();
+        }
+
+        //[low, high]와 겹치는 구간들입니다. 결과는 순회할 때 하나씩 찾습니다. O(log n) per result
+        query_range overlapping(const endpoint_type &low, const endpoint_type &high) const
+        {
+            return query_range(this, low, high);
+        }
+        query_range overlapping(const interval_type &range) const
+        {
+            return query_range(this, range.low, range.high);
+        }
+        //point를 포함하는 구간들입니다.
+        query_range stabbing(const endpoint_type &point) const
+        {
+            return query_range(this, point, point);
+        }
+        //겹치는 구간이 하나라도 있는지 봅니다. O(log n)
+        bool any_overlap(const endpoint_type &low, const endpoint_type &high) const
+        {
+            return this->_first_match(this->_root, low, high) != nullptr;
+        }
+
+        //모든 구간 중 가장 큰 high입니다. 비어 있으면 안 됩니다.
+        const endpoint_type &max_endpoint() const
+        {
+            assert(this->_root != nullptr);
+            return this->_root->max;
+        }
+
+    public: //iterator
+        iterator begin() noexcept
+        {
+            return iterator(_leftmost(this->_root), this);
+        }
+        iterator end() noexcept
+        {
+            return iterator(nullptr, this);
+        }
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(_leftmost(this->_root), this);
+        }
+        const_iterator end() const noexcept
+        {
+            return const_iterator(nullptr, this);
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return this->begin();
+        }
+        const_iterator cend() const noexcept
+        {
+            return this->end();
+        }
+
+    public: //reverse iterator
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(this->end());
+        }
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(this->begin());
+        }
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return this->rbegin();
+        }
+        const_reverse_iterator crend() const noexcept
+        {
+            return this->rend();
+        }
+
+    public:
+        class iterator
+        {
+        private:
+            friend interval_tree;
+            _node *current = nullptr;
+            const interval_tree *owner = nullptr; //end()에서 --할 때 마지막 node를 찾기 위함입니다.
+
+        public:
+            using Self = iterator;
+
+        public:
+            using value_type = typename interval_tree::value_type;
+            using pointer = typename interval_tree::pointer;
+            using reference = typename interval_tree::reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            iterator() = default;
+            iterator(_node *p, const interval_tree *tree) : current(p), owner(tree)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(current != nullptr);
+                current = _successor(current);
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self old = *this;
+                ++*this;
+                return old;
+            }
+            Self &operator--()
+            {
+                current = current == nullptr ? _rightmost(owner->_root) : _predecessor(current);
+                assert(current != nullptr);
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self old = *this;
+                --*this;
+                return old;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                assert(current != nullptr);
+                return current->value;
+            }
+            pointer operator->() const
+            {
+                assert(current != nullptr);
+                return &current->value;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+
+        class const_iterator
+        {
+        private:
+            friend interval_tree;
+            const _node *current = nullptr;
+            const interval_tree *owner = nullptr;
+
+        public:
+            using Self = const_iterator;
+
+        public:
+            using value_type = typename interval_tree::value_type;
+            using pointer = typename interval_tree::const_pointer;
+            using reference = typename interval_tree::const_reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+        public:
+            const_iterator() = default;
+            const_iterator(const _node *p, const interval_tree *tree) : current(p), owner(tree)
+            {
+            }
+            const_iterator(const iterator &mutable_iterator) : current(mutable_iterator.current), owner(mutable_iterator.owner)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(current != nullptr);
+                current = _successor(const_cast<_node *>(current));
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self old = *this;
+                ++*this;
+                return old;
+            }
+            Self &operator--()
+            {
+                current = current == nullptr ? _rightmost(owner->_root) : _predecessor(const_cast<_node *>(current));
+                assert(current != nullptr);
+                return *this;
+            }
+            Self operator--(int)
+            {
+                Self old = *this;
+                --*this;
+                return old;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                assert(current != nullptr);
+                return current->value;
+            }
+            pointer operator->() const
+            {
+                assert(current != nullptr);
+                return &current->value;
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+
+        //질의와 겹치는 구간만 중위 순서로 지나갑니다. 트리가 바뀌면 무효가 됩니다.
+        class query_iterator
+        {
+        private:
+            friend interval_tree;
+            _node *current = nullptr;
+            const interval_tree *owner = nullptr;
+            endpoint_type low{};
+            endpoint_type high{};
+
+        public:
+            using Self = query_iterator;
+
+        public:
+            using value_type = typename interval_tree::value_type;
+            using pointer = typename interval_tree::const_pointer;
+            using reference = typename interval_tree::const_reference;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+        public:
+            query_iterator() = default;
+            query_iterator(_node *p, const interval_tree *tree, const endpoint_type &_low, const endpoint_type &_high)
+                : current(p), owner(tree), low(_low), high(_high)
+            {
+            }
+
+        public: //move operator
+            Self &operator++()
+            {
+                assert(current != nullptr);
+                current = owner->_next_match(current, low, high);
+                return *this;
+            }
+            Self operator++(int)
+            {
+                Self old = *this;
+                ++*this;
+                return old;
+            }
+
+        public: //access operator
+            reference operator*() const
+            {
+                assert(current != nullptr);
+                return current->value;
+            }
+            pointer operator->() const
+            {
+                assert(current != nullptr);
+                return &current->value;
+            }
+            //erase에 넘길 수 있는 일반 iterator입니다.
+            const_iterator base() const
+            {
+                return const_iterator(current, owner);
+            }
+
+        public: //comparer
+            bool operator==(const Self &other) const
+            {
+                return this->current == other.current;
+            }
+            bool operator!=(const Self &other) const
+            {
+                return this->current != other.current;
+            }
+        };
+
+        //첫 결과는 begin()에서 찾습니다.
+        class query_range
+        {
+        private:
+            const interval_tree *_owner;
+            endpoint_type _low;
+            endpoint_type _high;
+
+        public:
+            query_range(const interval_tree *owner, const endpoint_type &low, const endpoint_type &high) : _owner(owner), _low(low), _high(high)
+            {
+            }
+            query_iterator begin() const
+            {
+                return query_iterator(this->_owner->_first_match(this->_owner->_root, this->_low, this->_high), this->_owner, this->_low, this->_high);
+            }
+            query_iterator end() const
+            {
+                return query_iterator(nullptr, this->_owner, this->_low, this->_high);
+            }
+            bool empty() const
+            {
+                return this->_owner->_first_match(this->_owner->_root, this->_low, this->_high) == nullptr;
+            }
+        };
+    };
+
+    template <class T, class V, class Compare>
+    constexpr std::uint64_t interval_tree<T, V, Compare>::default_seed;
+} // namespace xstl
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef __XSTL_SEGMENT_TREE__
+#define __XSTL_SEGMENT_TREE__
+
+/*
+    Flat Segment Tree with Lazy Propagation.
+    Node k has children 2k and 2k+1 in one fixed_vector; leaves start at a power of two, so no pointers are stored.
+    Range updates and range queries run bottom-up over [first, last) in O(log n),
+    pushing pending updates down only along the two boundary paths.
+    What a node holds and how an update acts on it is given by a Policy (range_sum, range_min, range_max).
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include "../array/fixed_vector.h"
+#include "../utility/bit_operation.h"
+
+namespace xstl
+{
+    //구간에 더하기, 구간 합입니다.
+    template <class T>
+    struct range_sum
+    {
+        using value_type = T;
+        using update_type = T;
+
+        static value_type identity()
+        {
+            return value_type();
+        }
+        static update_type no_update()
+        {
+            return update_type();
+        }
+        static value_type combine(const value_type &left, const value_type &right)
+        {
+            return left + right;
+        }
+        //length개 요소를 덮는 node에 update를 적용합니다.
+        static value_type apply(const value_type &value, const update_type &update, std::size_t length)
+        {
+            return value + update * static_cast<value_type>(length);
+        }
+        //older 뒤에 newer가 온 것과 같은 update입니다.
+        static update_type compose(const update_type &older, const update_type &newer)
+        {
+            return older + newer;
+        }
+    };
+
+    //구간에 더하기, 구간 최솟값입니다.
+    template <class T>
+    struct range_min
+    {
+        using value_type = T;
+        using update_type = T;
+
+        static value_type identity()
+        {
+            return std::numeric_limits<value_type>::max();
+        }
+        static update_type no_update()
+        {
+            return update_type();
+        }
+        static value_type combine(const value_type &left, const value_type &right)
+        {
+            return right < left ? right : left;
+        }
+        static value_type apply(const value_type &value, const update_type &update, std::size_t)
+        {
+            return value + update;
+        }
+        static update_type compose(const update_type &older, const update_type &newer)
+        {
+            return older + newer;
+        }
+    };
+
+    //구간에 더하기, 구간 최댓값입니다.
+    template <class T>
+    struct range_max
+    {
+        using value_type = T;
+        using update_type = T;
+
+        static value_type identity()
+        {
+            return std::numeric_limits<value_type>::lowest();
+        }
+        static update_type no_update()
+        {
+            return update_type();
+        }
+        static value_type combine(const value_type &left, const value_type &right)
+        {
+            return left < right ? right : left;
+        }
+        static value_type apply(const value_type &value, const update_type &update, std::size_t)
+        {
+            return value + update;
+        }
+        static update_type compose(const update_type &older, const update_type &newer)
+        {
+            return older + newer;
+        }
+    };
+
+    template <class T, class Policy = range_sum<T>, class Allocation = default_allocation>
+    class segment_tree
+    {
+    public:
+        using Self = segment_tree;
+
+    public: //stl standard type member
+        using value_type = typename Policy::value_type;
+        using update_type = typename Policy::update_type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using policy_type = Policy;
+        using allocation_type = Allocation;
+
+    private:
+        size_type _length = 0;
+        size_type _leaves = 0; //_length 이상인 2의 거듭제곱
+        unsigned _height = 0;  //log2(_leaves)
+        fixed_vector<value_type, Allocation> _values;   //[1, 2 * _leaves), 잎은 [_leaves, 2 * _leaves)
+        fixed_vector<update_type, Allocation> _pending; //[1, _leaves), 자식에 아직 내려보내지 않은 update
+
+    private:
+        //node k가 덮는 요소 수입니다.
+        size_type _span(size_type node) const noexcept
+        {
+            return this->_leaves >> (63 - _count_leading_zero64(node));
+        }
+        void _apply(size_type node, const update_type &update)
+        {
+            this->_values[node] = Policy::apply(this->_values[node], update, this->_span(node));
+            if (node < this->_leaves)
+                this->_pending[node] = Policy::compose(this->_pending[node], update);
+        }
+        void _push(size_type node)
+        {
+            this->_apply(node * 2, this->_pending[node]);
+            this->_apply(node * 2 + 1, this->_pending[node]);
+            this->_pending[node] = Policy::no_update();
+        }
+        void _pull(size_type node)
+        {
+            this->_values[node] = Policy::combine(this->_values[node * 2], this->_values[node * 2 + 1]);
+        }
+        //[first, last) 경계를 지나는 조상들의 update를 위에서부터 내려보냅니다.
+        void _push_boundary(size_type first, size_type last)
+        {
+            for (unsigned level = this->_height; level >= 1; level--)
+            {
+                if (((first >> level) << level) != first)
+                    this->_push(first >> level);
+                if (((last >> level) << level) != last)
+                    this->_push((last - 1) >> level);
+            }
+        }
+
+        void _build()
+        {
+            for (size_type node = this->_leaves - 1; node >= 1; node--)
+                this->_pull(node);
+        }
+        void _reserve(size_type length)
+        {
+            this->_length = length;
+            this->_leaves = 1;
+            this->_height = 0;
+            while (this->_leaves < length)
+            {
+                this->_leaves <<= 1;
+                this->_height++;
+            }
+            //남는 잎은 identity라서 결과에 영향을 주지 않습니다.
+            this->_values = fixed_vector<value_type, Allocation>(this->_leaves * 2, Policy::identity());
+            this->_pending = fixed_vector<update_type, Allocation>(this->_leaves, Policy::no_update());
+        }
+
+    public:
+        segment_tree() = default;
+        explicit segment_tree(size_type length, const value_type &value = value_type())
+        {
+            this->_reserve(length);
+            for (size_type i = 0; i < length; i++)
+                this->_values[this->_leaves + i] = value;
+            this->_build();
+        }
+        template <class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        segment_tree(InputIterator begin, InputIterator end)
+        {
+            this->_reserve(static_cast<size_type>(std::distance(begin, end)));
+            for (size_type i = 0; begin != end; ++begin, ++i)
+                this->_values[this->_leaves + i] = *begin;
+            this->_build();
+        }
+        template <class SourceAllocation>
+        explicit segment_tree(const fixed_vector<value_type, SourceAllocation> &values) : segment_tree(values.begin(), values.end())
+        {
+        }
+
+    public: //copy & move
+        segment_tree(const Self &) = default;
+        segment_tree(Self &&) = default;
+        Self &operator=(const Self &) = default;
+        Self &operator=(Self &&) = default;
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+
+    public: //modifiers
+        //[first, last)의 모든 요소에 update를 적용합니다. O(log n)
+        void update(size_type first, size_type last, const update_type &update)
+        {
+            assert(first <= last && last <= this->_length);
+            if (first == last)
+                return;
+            first += this->_leaves;
+            last += this->_leaves;
+            this->_push_boundary(first, last);
+
+            for (size_type left = first, right = last; left < right; left >>= 1, right >>= 1)
+            {
+                if (left & 1)
+                    this->_apply(left++, update);
+                if (right & 1)
+                    this->_apply(--right, update);
+            }
+
+            for (unsigned level = 1; level <= this->_height; level++)
+            {
+                if (((first >> level) << level) != first)
+                    this->_pull(first >> level);
+                if (((last >> level) << level) != last)
+                    this->_pull((last - 1) >> level);
+            }
+        }
+        //range_sum, range_min, range_max에서는 더하기입니다.
+        void add(size_type first, size_type last, const update_type &delta)
+        {
+            this->update(first, last, delta);
+        }
+
+        void set(size_type index, const value_type &value)
+        {
+            assert(index < this->_length);
+            size_type node = index + this->_leaves;
+            for (unsigned level = this->_height; level >= 1; level--)
+                this->_push(node >> level);
+            this->_values[node] = value;
+            for (unsigned level = 1; level <= this->_height; level++)
+                this->_pull(node >> level);
+        }
+
+    public: //lookup
+        //[first, last)를 Policy::combine으로 합친 값입니다. 비어 있으면 identity입니다. O(log n)
+        value_type query(size_type first, size_type last)
+        {
+            assert(first <= last && last <= this->_length);
+            if (first == last)
+                return Policy::identity();
+            first += this->_leaves;
+            last += this->_leaves;
+            this->_push_boundary(first, last);
+
+            value_type left_sum = Policy::identity();
+            value_type right_sum = Policy::identity();
+            for (; first < last; first >>= 1, last >>= 1)
+            {
+                if (first & 1)
+                    left_sum = Policy::combine(left_sum, this->_values[first++]);
+                if (last & 1)
+                    right_sum = Policy::combine(this->_values[--last], right_sum);
+            }
+            return Policy::combine(left_sum, right_sum);
+        }
+        value_type get(size_type index)
+        {
+            assert(index < this->_length);
+            size_type node = index + this->_leaves;
+            for (unsigned level = this->_height; level >= 1; level--)
+                this->_push(node >> level);
+            return this->_values[node];
+        }
+        //전체를 합친 값입니다. O(1)
+        value_type all() const
+        {
+            return this->_length != 0 ? this->_values[1] : Policy::identity();
+        }
+    };
+} // namespace xstl
+
+#endif
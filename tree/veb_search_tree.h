@@ -0,0 +1,291 @@
+#ifndef __XSTL_VEB_SEARCH_TREE__
+#define __XSTL_VEB_SEARCH_TREE__
+
+/*
+    Static Search Tree in van Emde Boas Layout.
+    Built once from sorted data. The implicit complete binary search tree is cut at half its height,
+    the top half is stored first and every bottom subtree follows contiguously, recursively.
+    A root-to-leaf path of height h then touches O(log_B n) blocks for every block size B at once.
+    Navigation uses the per-depth tables of Brodal, Fagerberg and Jacob, so no child pointers are stored.
+    The tree is padded to 2^h - 1 slots with copies of the largest element.
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include "../array/fixed_vector.h"
+#include "../utility/bit_operation.h"
+
+namespace xstl
+{
+    template <class T, class Compare = std::less<T>, class Allocation = default_allocation>
+    class veb_search_tree
+    {
+    public:
+        using Self = veb_search_tree;
+
+    public: //stl standard type member
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using key_compare = Compare;
+        using const_reference = const value_type &;
+        using const_pointer = const value_type *;
+        using allocation_type = Allocation;
+
+    public:
+        static constexpr unsigned max_height = 64;
+
+    private:
+        fixed_vector<T, Allocation> _tree; //vEB 순서로 놓인 2^h - 1개 요소
+        size_type _length = 0;             //padding을 뺀 요소 수
+        unsigned _height = 0;
+        Compare _compare;
+
+        //depth d에서 시작하는 bottom tree의 크기, 그 위 top tree의 크기(= 2^k - 1, mask로도 씀), top tree root의 depth
+        size_type _bottom_size[max_height] = {};
+        size_type _top_size[max_height] = {};
+        unsigned _top_depth[max_height] = {};
+
+    private:
+        static size_type _full_size(unsigned height) noexcept
+        {
+            return height == 0 ? 0 : (~static_cast<size_type>(0) >> (sizeof(size_type) * 8 - height));
+        }
+
+        //높이 height인 subtree를 위아래 절반으로 잘라 표를 채웁니다.
+        void _split(unsigned depth, unsigned height) noexcept
+        {
+            if (height <= 1)
+                return;
+            unsigned top = height / 2;
+            unsigned bottom = height - top;
+            this->_top_depth[depth + top] = depth;
+            this->_top_size[depth + top] = _full_size(top);
+            this->_bottom_size[depth + top] = _full_size(bottom);
+            this->_split(depth, top);
+            this->_split(depth + top, bottom);
+        }
+
+        //BFS 번호 index(1부터)인 depth의 node가 배열에서 어디 있는지 구합니다. position[0..depth-1]은 경로의 조상 위치입니다.
+        size_type _position(size_type index, unsigned depth, const size_type *position) const noexcept
+        {
+            if (depth == 0)
+                return 0;
+            size_type mask = this->_top_size[depth];
+            return position[this->_top_depth[depth]] + mask + (index & mask) * this->_bottom_size[depth];
+        }
+
+        //중위 순회 순서로 sorted의 요소를 자기 자리에 놓습니다.
+        void _place(const T *sorted, size_type &next, size_type index, unsigned depth, size_type *position)
+        {
+            if (depth == this->_height)
+                return;
+            position[depth] = this->_position(index, depth, position);
+            this->_place(sorted, next, index * 2, depth + 1, position);
+            if (next < this->_length)
+                this->_tree[position[depth]] = sorted[next++];
+            this->_place(sorted, next, index * 2 + 1, depth + 1, position);
+        }
+
+        //BFS 번호와 정렬 순위를 서로 바꿉니다. (높이 _height인 완전 이진 트리 기준)
+        size_type _rank_of(size_type index) const noexcept
+        {
+            unsigned depth = 63 - _count_leading_zero64(index);
+            size_type offset = index - (static_cast<size_type>(1) << depth);
+            return ((offset * 2 + 1) << (this->_height - 1 - depth)) - 1;
+        }
+        size_type _index_of(size_type rank, unsigned &depth) const noexcept
+        {
+            size_type inorder = rank + 1;
+            unsigned zeros = _count_trailing_zero64(inorder);
+            depth = this->_height - 1 - zeros;
+            return (inorder >> (zeros + 1)) + (static_cast<size_type>(1) << depth);
+        }
+
+        //key보다 작지 않은 첫 요소의 BFS 번호입니다. (없으면 0)
+        template <class Less>
+        size_type _descend(Less &&less) const
+        {
+            size_type position[max_height];
+            size_type index = 1;
+            size_type found = 0;
+            for (unsigned depth = 0; depth < this->_height; depth++)
+            {
+                position[depth] = this->_position(index, depth, position);
+                //분기 없이 내려가도록 비교 결과를 그대로 index에 더합니다.
+                bool go_right = less(this->_tree[position[depth]]);
+                found = go_right ? found : index;
+                index = index * 2 + (go_right ? 1 : 0);
+            }
+            return found;
+        }
+
+    public:
+        veb_search_tree() = default;
+        explicit veb_search_tree(const Compare &compare) : _compare(compare)
+        {
+        }
+        //sorted는 compare 기준으로 정렬되어 있어야 합니다.
+        template <class SourceAllocation>
+        explicit veb_search_tree(const fixed_vector<T, SourceAllocation> &sorted, const Compare &compare = Compare()) : _compare(compare)
+        {
+            this->assign(sorted);
+        }
+
+    public: //copy & move
+        veb_search_tree(const Self &) = default;
+        veb_search_tree(Self &&) = default;
+        Self &operator=(const Self &) = default;
+        Self &operator=(Self &&) = default;
+
+    public: //modifiers
+        //정렬된 데이터로 전체를 다시 만듭니다.
+        template <class SourceAllocation>
+        void assign(const fixed_vector<T, SourceAllocation> &sorted)
+        {
+            this->assign(sorted.data(), sorted.size());
+        }
+        void assign(const T *sorted, size_type length)
+        {
+            for (size_type i = 1; i < length; i++)
+                assert(!this->_compare(sorted[i], sorted[i - 1]));
+
+            unsigned height = 0;
+            while (_full_size(height) < length)
+                height++;
+
+            //빈 자리는 가장 큰 요소로 채워 중위 순서가 정렬된 채로 남게 합니다.
+            fixed_vector<T, Allocation> tree;
+            if (length != 0)
+                tree = fixed_vector<T, Allocation>(_full_size(height), sorted[length - 1]);
+
+            this->_tree = std::move(tree);
+            this->_length = length;
+            this->_height = height;
+            for (unsigned depth = 0; depth < max_height; depth++)
+                this->_bottom_size[depth] = this->_top_size[depth] = this->_top_depth[depth] = 0;
+            this->_split(0, height);
+
+            size_type position[max_height];
+            size_type next = 0;
+            this->_place(sorted, next, 1, 0, position);
+        }
+        void clear() noexcept
+        {
+            this->_tree = fixed_vector<T, Allocation>();
+            this->_length = 0;
+            this->_height = 0;
+        }
+        void swap(Self &other) noexcept
+        {
+            std::swap(*this, other);
+        }
+
+    public: //capacity
+        bool empty() const noexcept
+        {
+            return this->_length == 0;
+        }
+        size_type size() const noexcept
+        {
+            return this->_length;
+        }
+        unsigned height() const noexcept
+        {
+            return this->_height;
+        }
+        //padding을 포함한 배열 크기입니다.
+        size_type capacity() const noexcept
+        {
+            return this->_tree.size();
+        }
+
+    public: //lookup
+        //정렬 순위를 돌려줍니다. 만들 때 쓴 정렬 배열의 index와 같습니다.
+        size_type lower_bound(const value_type &key) const
+        {
+            size_type found = this->_descend([&](const value_type &value) { return this->_compare(value, key); });
+            if (found == 0)
+                return this->_length;
+            size_type rank = this->_rank_of(found);
+            return rank < this->_length ? rank : this->_length;
+        }
+        size_type upper_bound(const value_type &key) const
+        {
+            size_type found = this->_descend([&](const value_type &value) { return !this->_compare(key, value); });
+            if (found == 0)
+                return this->_length;
+            size_type rank = this->_rank_of(found);
+            return rank < this->_length ? rank : this->_length;
+        }
+        size_type count(const value_type &key) const
+        {
+            return this->upper_bound(key) - this->lower_bound(key);
+        }
+        bool contains(const value_type &key) const
+        {
+            return this->find(key) != nullptr;
+        }
+        //key와 같은 요소 하나를 가리킵니다. 없으면 nullptr입니다.
+        const_pointer find(const value_type &key) const
+        {
+            size_type position[max_height];
+            size_type index = 1;
+            const_pointer found = nullptr;
+            for (unsigned depth = 0; depth < this->_height; depth++)
+            {
+                position[depth] = this->_position(index, depth, position);
+                const value_type &value = this->_tree[position[depth]];
+                if (this->_compare(value, key))
+                    index = index * 2 + 1;
+                else
+                {
+                    found = &value;
+                    index = index * 2;
+                }
+            }
+            return found != nullptr && !this->_compare(key, *found) ? found : nullptr;
+        }
+
+    public: //element access
+        //정렬 순위 rank의 요소입니다. O(log n)
+        const_reference operator[](size_type rank) const
+        {
+            assert(rank < this->_length);
+            unsigned depth;
+            size_type index = this->_index_of(rank, depth);
+            size_type position[max_height];
+            for (unsigned d = 0; d <= depth; d++)
+                position[d] = this->_position(index >> (depth - d), d, position);
+            return this->_tree[position[depth]];
+        }
+        const_reference at(size_type rank) const
+        {
+            if (rank >= this->_length)
+                throw std::out_of_range("veb_search_tree::at");
+            return (*this)[rank];
+        }
+        const_reference front() const
+        {
+            return (*this)[0];
+        }
+        const_reference back() const
+        {
+            return (*this)[this->_length - 1];
+        }
+
+        //vEB 순서 그대로의 배열입니다.
+        const_pointer data() const noexcept
+        {
+            return this->_tree.data();
+        }
+    };
+
+    template <class T, class Compare, class Allocation>
+    constexpr unsigned veb_search_tree<T, Compare, Allocation>::max_height;
+} // namespace xstl
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef __XSTL_ATOMIC_WAIT__
+#define __XSTL_ATOMIC_WAIT__
+
+/*
+    Blocking Wait on a 32 bit Atomic.
+    Linux uses futex directly. Other platforms park on a mutex/condition_variable picked by address.
+    _wait_channel adds an epoch and a waiter count on top, so notify() costs one fence and one load when nobody waits.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace xstl
+{
+#if !defined(__linux__)
+    struct _parking_slot
+    {
+        std::mutex lock;
+        std::condition_variable condition;
+    };
+    inline _parking_slot &_parking_slot_of(const void *address)
+    {
+        static _parking_slot slots[64];
+        return slots[(reinterpret_cast<std::uintptr_t>(address) >> 4) & 63];
+    }
+#endif
+
+    //word가 expected인 동안 잠듭니다. 가짜로 깨어날 수 있으므로 호출자가 조건을 다시 봐야 합니다.
+    inline void _atomic_wait(std::atomic<std::uint32_t> &word, std::uint32_t expected)
+    {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+        _parking_slot &slot = _parking_slot_of(&word);
+        std::unique_lock<std::mutex> guard(slot.lock);
+        if (word.load(std::memory_order_acquire) == expected)
+            slot.condition.wait(guard);
+#endif
+    }
+
+    inline void _atomic_notify_all(std::atomic<std::uint32_t> &word)
+    {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE_PRIVATE, 0x7fffffff, nullptr, nullptr, 0);
+#else
+        _parking_slot &slot = _parking_slot_of(&word);
+        {
+            //waiter가 값 확인과 wait 사이에 있다면 lock이 풀릴 때까지 기다려 깨움을 놓치지 않게 합니다.
+            std::lock_guard<std::mutex> guard(slot.lock);
+        }
+        slot.condition.notify_all();
+#endif
+    }
+
+    //"비어 있지 않음", "가득 차지 않음" 같은 조건 하나를 기다리는 통로입니다.
+    struct _wait_channel
+    {
+        std::atomic<std::uint32_t> epoch{0};
+        std::atomic<std::uint32_t> waiting{0};
+
+        //attempt()가 true를 돌려줄 때까지 잠깐 돌고, 그래도 안 되면 잠듭니다.
+        template <class Attempt>
+        void wait_until(Attempt attempt, unsigned spin_limit = 128)
+        {
+            for (unsigned spin = 0;; spin++)
+            {
+                if (attempt())
+                    return;
+                if (spin < spin_limit)
+                    continue;
+
+                std::uint32_t current = this->epoch.load(std::memory_order_acquire);
+                this->waiting.fetch_add(1, std::memory_order_relaxed);
+                //등록과 조건 재확인 사이의 순서를 notify()의 fence와 맞춥니다.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (attempt())
+                {
+                    this->waiting.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+                _atomic_wait(this->epoch, current);
+                this->waiting.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        //조건을 만족시키는 쓰기를 마친 뒤 부릅니다.
+        void notify()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (this->waiting.load(std::memory_order_relaxed) == 0)
+                return;
+            this->epoch.fetch_add(1, std::memory_order_release);
+            _atomic_notify_all(this->epoch);
+        }
+    };
+} // namespace xstl
+
+#endif
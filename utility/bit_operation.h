@@ -0,0 +1,72 @@
+#ifndef __XSTL_BIT_OPERATION__
+#define __XSTL_BIT_OPERATION__
+
+/*
+    Bit Scan / Count Helpers.
+    Uses compiler intrinsics when available and portable loops otherwise.
+*/
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h> //__popcnt64, _BitScanForward64, _BitScanReverse64
+#endif
+
+namespace xstl
+{
+    inline unsigned _popcount64(std::uint64_t word) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<unsigned>(__popcnt64(word));
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ull);
+        word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<unsigned>((word * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    //word는 0이 아니어야 합니다.
+    inline unsigned _count_trailing_zero64(std::uint64_t word) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return static_cast<unsigned>(index);
+#else
+        unsigned count = 0;
+        while ((word & 1) == 0)
+        {
+            word >>= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    //word는 0이 아니어야 합니다.
+    inline unsigned _count_leading_zero64(std::uint64_t word) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_clzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, word);
+        return static_cast<unsigned>(63 - index);
+#else
+        unsigned count = 0;
+        while ((word & (std::uint64_t(1) << 63)) == 0)
+        {
+            word <<= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+} // namespace xstl
+
+#endif